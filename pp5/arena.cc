@@ -0,0 +1,67 @@
+/* File: arena.cc
+ * --------------
+ * Implementation of the Arena. Memory comes from malloc in chunks of
+ * ChunkSize bytes, each starting with a header that links the chunks
+ * together for Release. A request too large to share a chunk gets a
+ * chunk of its own, and the chunk being carved up stays current.
+ * Everything is plain static data, since the built-in types are
+ * allocated during static initialization.
+ */
+
+#include "arena.h"
+#include "utility.h"
+#include <string.h>
+
+struct Chunk {
+  Chunk *next;
+  double align;                           // keeps what follows aligned
+};
+
+static const size_t ChunkSize = 64 * 1024;
+static const size_t Align = sizeof(double);
+
+static Chunk *chunks;
+static char *next, *limit;
+
+
+static char *NewChunk(size_t size)
+{
+  Chunk *c = (Chunk *)malloc(sizeof(Chunk) + size);
+  if (!c) Failure("Out of memory!");
+  c->next = chunks;
+  chunks = c;
+  return (char *)(c + 1);
+}
+
+
+void *Arena::Allocate(size_t numBytes)
+{
+  numBytes = (numBytes + Align - 1) & ~(Align - 1);
+  if (numBytes > limit - next) {
+    if (numBytes > ChunkSize / 4)
+      return NewChunk(numBytes);
+    next = NewChunk(ChunkSize);
+    limit = next + ChunkSize;
+  }
+  void *result = next;
+  next += numBytes;
+  return result;
+}
+
+
+char *Arena::Strdup(const char *str)
+{
+  size_t len = strlen(str) + 1;
+  return (char *)memcpy(Allocate(len), str, len);
+}
+
+
+void Arena::Release()
+{
+  while (chunks) {
+    Chunk *c = chunks;
+    chunks = c->next;
+    free(c);
+  }
+  next = limit = NULL;
+}
@@ -0,0 +1,39 @@
+/* File: arena.h
+ * -------------
+ * The Arena is a bump allocator for everything the front end builds
+ * while reading a program: the nodes of the parse tree, their source
+ * locations, Lists, string constants and the spellings of interned
+ * names. None of these are freed one at a time; the whole arena is
+ * released at once when compilation is over (see main.cc), so an
+ * allocation is usually just an increment of a pointer into the
+ * current chunk.
+ *
+ * Classes whose objects belong in the arena declare the operators
+ * from ArenaAllocated, as Node and List do, and are then created with
+ * a plain new. Their destructors never run.
+ */
+
+#ifndef _H_arena
+#define _H_arena
+
+#include <stddef.h>
+
+class Arena {
+  public:
+         // Returns numBytes of uninitialized memory, aligned for any
+         // type, valid until Release.
+    static void *Allocate(size_t numBytes);
+
+         // Returns a copy of str in the arena.
+    static char *Strdup(const char *str);
+
+         // Frees everything allocated so far, all at once.
+    static void Release();
+};
+
+
+#define ArenaAllocated                                                  \
+  static void *operator new(size_t size) { return Arena::Allocate(size); } \
+  static void operator delete(void *) {}
+
+#endif
@@ -5,17 +5,20 @@
 #include "ast.h"
 #include "ast_type.h"
 #include "ast_decl.h"
-#include <string.h> // strdup
 #include <stdio.h>  // printf
+#include <new>      // placement new
 
 Node::Node(yyltype loc) {
-    location = new yyltype(loc);
+    location = new (Arena::Allocate(sizeof(yyltype))) yyltype(loc);
     parent = NULL;
+    memloc = NULL;
+    nodeScope = NULL;
 }
 
 Node::Node() {
     location = NULL;
     parent = NULL;
+    memloc = NULL;
     nodeScope = NULL;
 }
 
@@ -31,7 +34,7 @@ Decl *Node::FindDecl(Identifier *id, lookup l) {
     return NULL;
 }
 	 
-Identifier::Identifier(yyltype loc, const char *n) : Node(loc) {
-    name = strdup(n);
+Identifier::Identifier(yyltype loc, Symbol s) : Node(loc) {
+    symbol = s;
 } 
 
@@ -31,12 +31,18 @@
 
 #include <stdlib.h>   // for NULL
 #include "location.h"
+#include "arena.h"
+#include "symtab.h"
 #include "codegen.h"
 #include <iostream>
 #include "scope.h"
+#include "flatast.h"
 
 class Node 
 {
+  public:
+    ArenaAllocated
+
   protected:
     yyltype *location;
     Node *parent;
@@ -51,8 +57,17 @@ class Node
     void SetParent(Node *p)  { parent = p; }
     Node *GetParent()        { return parent; }
 
+         // Binds the names used under this node to their declarations
+         // and gives variables their storage, with the scopes enclosing
+         // the node open on scopes. Runs once, before Emit, which then
+         // only reads the bindings (see Program::Resolve).
+    virtual void Resolve(ScopeStack *scopes) {}
     virtual void Emit(Scope* nodeScope)      {};
     virtual void Check() {} // not abstract, since some nodes have nothing to do
+
+         // Appends this node and those under it to the flat tree and
+         // returns its NodeRef (see flatast.h). Run after Resolve.
+    virtual NodeRef Flatten(FlatAst *ast) { return FlatAst::NoNode; }
     virtual Location* GetMemoryLocation() { return memloc; }
     
     typedef enum { kShallow, kDeep } lookup;
@@ -64,12 +79,13 @@ class Node
 class Identifier : public Node 
 {
   protected:
-    char *name;
+    Symbol symbol;
     
   public:
-    Identifier(yyltype loc, const char *name);
-    friend std::ostream& operator<<(std::ostream& out, Identifier *id) { return out << id->name; }
-    const char* GetName() { return name; }
+    Identifier(yyltype loc, Symbol symbol);
+    friend std::ostream& operator<<(std::ostream& out, Identifier *id) { return out << id->GetName(); }
+    const char* GetName() { return SymbolTable::Name(symbol); }
+    Symbol GetSymbol() { return symbol; }
 };
 
 
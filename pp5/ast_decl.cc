@@ -29,12 +29,18 @@ ClassDecl::ClassDecl(Identifier *n, NamedType *ex, List<NamedType*> *imp, List<D
     if (extends) extends->SetParent(this);
     (implements=imp)->SetParentAll(this);
     (members=m)->SetParentAll(this);
+    imp_decls = NULL;
+    base = NULL;
+    preparing = false;
+    subclasses = new List<ClassDecl*>;
+    preorder = postorder = -1;
 }
 
 
 InterfaceDecl::InterfaceDecl(Identifier *n, List<Decl*> *m) : Decl(n) {
     Assert(n != NULL && m != NULL);
     (members=m)->SetParentAll(this);
+    index = -1;
 }
 
 	
@@ -43,29 +49,34 @@ FnDecl::FnDecl(Identifier *n, Type *r, List<VarDecl*> *d) : Decl(n) {
     (returnType=r)->SetParent(this);
     (formals=d)->SetParentAll(this);
     body = NULL;
+    localBytes = 0;
 }
 
 void FnDecl::SetFunctionBody(Stmt *b) { 
     (body=b)->SetParent(this);
 }
 
-// This is not done very cleanly. I should sit down and sort this out. Right now
-// I was using the copy-in strategy from the old compiler, but I think the link to
-// parent may be the better way now.
+// The class scope links to its parent's scope and then to those of its
+// interfaces (see Scope::AddInherited) instead of copying them in. In
+// an extends cycle we come back to a class still being prepared; its
+// scope is not linked, so the links never go round in a loop.
 Scope *ClassDecl::PrepareScope()
 {
     if (nodeScope) return nodeScope;
     nodeScope = new Scope();
     if (extends) {
         ClassDecl *ext = dynamic_cast<ClassDecl*>(parent->FindDecl(extends->GetId()));
-        if (ext) nodeScope->CopyFromScope(ext->PrepareScope(), this);
+        preparing = true;
+        if (ext && !ext->preparing) nodeScope->AddInherited(ext->PrepareScope());
+        preparing = false;
+        base = ext;
     }
     imp_decls = new List<InterfaceDecl*>;
     for (int i = 0; i < implements->NumElements(); i++) {
         NamedType *in = implements->Nth(i);
-        InterfaceDecl *id = dynamic_cast<InterfaceDecl*>(in->FindDecl(in->GetId()));
+        InterfaceDecl *id = dynamic_cast<InterfaceDecl*>(parent->FindDecl(in->GetId()));
         if (id) {
-            nodeScope->CopyFromScope(id->PrepareScope(), NULL);
+            nodeScope->AddInherited(id->PrepareScope());
             imp_decls->Append(id);
         }
     }
@@ -80,6 +91,94 @@ Scope *InterfaceDecl::PrepareScope() {
     return nodeScope;
 }
 
+// A class in an extends cycle, which NumberHierarchy leaves unnumbered,
+// inherits nothing from the classes in the cycle: its members are
+// resolved in a scope of their own, linked to its interfaces only.
+void ClassDecl::Resolve(ScopeStack *scopes) {
+    if (extends) extends->Resolve(scopes);
+    for (int i = 0; i < implements->NumElements(); i++)
+        implements->Nth(i)->Resolve(scopes);
+    Scope *scope = PrepareScope();
+    if (preorder < 0) {
+        scope = new Scope();
+        for (int i = 0; i < imp_decls->NumElements(); i++)
+            scope->AddInherited(imp_decls->Nth(i)->PrepareScope());
+        members->DeclareAll(scope);
+    }
+    scopes->Push(scope);
+    for (int i = 0; i < members->NumElements(); i++)
+        members->Nth(i)->Resolve(scopes);
+    scopes->Pop();
+}
+
+void InterfaceDecl::Resolve(ScopeStack *scopes) {
+    scopes->Push(PrepareScope());
+    for (int i = 0; i < members->NumElements(); i++)
+        members->Nth(i)->Resolve(scopes);
+    scopes->Pop();
+}
+
+void ClassDecl::NumberHierarchy(List<Decl*> *decls) {
+    int numInterfaces = 0;
+    List<ClassDecl*> roots;
+    for (int i = 0; i < decls->NumElements(); i++) {
+        InterfaceDecl *id = dynamic_cast<InterfaceDecl*>(decls->Nth(i));
+        if (id) id->SetIndex(numInterfaces++);
+    }
+    for (int i = 0; i < decls->NumElements(); i++) {
+        ClassDecl *cd = dynamic_cast<ClassDecl*>(decls->Nth(i));
+        if (!cd) continue;
+        cd->PrepareScope();
+        if (cd->base) cd->base->subclasses->Append(cd);
+        else roots.Append(cd);
+    }
+
+    // Walk the tree with an explicit stack, each class pushed twice:
+    // once to number it on the way down and once on the way back up.
+    // A class in an extends cycle has no root, stays unnumbered and is
+    // only a subclass of itself.
+    int next = 0;
+    List<ClassDecl*> stack;
+    List<bool> leaving;
+    for (int r = 0; r < roots.NumElements(); r++) {
+        stack.Append(roots.Nth(r));
+        leaving.Append(false);
+        while (stack.NumElements() > 0) {
+            int top = stack.NumElements() - 1;
+            ClassDecl *cd = stack.Nth(top);
+            bool up = leaving.Nth(top);
+            stack.RemoveAt(top);
+            leaving.RemoveAt(top);
+            if (up) {
+                cd->postorder = next++;
+                continue;
+            }
+            cd->preorder = next++;
+            if (cd->base) cd->interfaces = cd->base->interfaces;
+            cd->interfaces.resize(numInterfaces);
+            for (int i = 0; i < cd->imp_decls->NumElements(); i++)
+                cd->interfaces[cd->imp_decls->Nth(i)->GetIndex()] = true;
+            stack.Append(cd);
+            leaving.Append(true);
+            for (int i = cd->subclasses->NumElements() - 1; i >= 0; i--) {
+                stack.Append(cd->subclasses->Nth(i));
+                leaving.Append(false);
+            }
+        }
+    }
+}
+
+bool ClassDecl::IsSubclassOf(ClassDecl *other) {
+    return this == other || (other->preorder >= 0
+                             && other->preorder < preorder
+                             && postorder < other->postorder);
+}
+
+bool ClassDecl::Implements(InterfaceDecl *other) {
+    int i = other->GetIndex();
+    return i >= 0 && i < interfaces.size() && interfaces[i];
+}
+
 bool FnDecl::IsMethodDecl()
 { 
     return dynamic_cast<ClassDecl*>(parent) || dynamic_cast<InterfaceDecl*>(parent); 
@@ -102,12 +201,28 @@ bool FnDecl::ConflictsWithPrevious(Decl *prev) {
     return true;
 }
 
-void FnDecl::Emit(Scope* parentScope) {
+// Formals and locals get their frame slots here, so that the temps
+// allocated during Emit start below the locals.
+void FnDecl::Resolve(ScopeStack *scopes) {
+    CodeGenerator *codegen = CodeGenerator::getInstance();
+    returnType->Resolve(scopes);
     nodeScope = new Scope();
-    //(dynamic_cast<StmtBlock*>(body))->Declare(nodeScope);
-    CodeGenerator* codegen = CodeGenerator::getInstance();
-    // setup stack pointer for locals
+    formals->DeclareAll(nodeScope);
+    scopes->Push(nodeScope);
+    codegen->paramOffset = codegen->OffsetToFirstParam;
+    if (IsMethodDecl()) codegen->paramOffset += codegen->VarSize; // this
     codegen->localOffset = codegen->OffsetToFirstLocal;
+    for (int n = 0; n < formals->NumElements(); n++)
+        formals->Nth(n)->Resolve(scopes);
+    if (body) body->Resolve(scopes);
+    localBytes = codegen->OffsetToFirstLocal - codegen->localOffset;
+    scopes->Pop();
+}
+
+void FnDecl::Emit(Scope* parentScope) {
+    CodeGenerator* codegen = CodeGenerator::getInstance();
+    // setup stack pointer for temps, after the locals
+    codegen->localOffset = codegen->OffsetToFirstLocal - localBytes;
     // set offset to parent class if it exists
     // GenLoadLabel
     string function_name = string(GetName());
@@ -122,11 +237,6 @@ void FnDecl::Emit(Scope* parentScope) {
     // else check if it is a class method
     // GenBeginFunc
     BeginFunc *begin_function = codegen->GenBeginFunc();
-    if (formals) {
-        codegen->paramOffset = codegen->OffsetToFirstParam;
-        for (int n = 0; n < formals->NumElements(); n++)
-            formals->Nth(n)->Emit(nodeScope);
-    }
     if (body) body->Emit(nodeScope);
 
     // backpatching based on size of variables used in function
@@ -135,9 +245,22 @@ void FnDecl::Emit(Scope* parentScope) {
     codegen->GenEndFunc();
 }
 
-void VarDecl::Emit(Scope* parentScope) {
-    nodeScope = parentScope;
-    memloc = CodeGenerator::getInstance()->GenTempVar();
+// A variable's storage depends on where it is declared: globals are
+// gp relative, formals and locals fp relative. Instance variables live
+// in the object and are reached through this, so they get none.
+void VarDecl::Resolve(ScopeStack *scopes) {
+    CodeGenerator *codegen = CodeGenerator::getInstance();
+    type->Resolve(scopes);
+    if (dynamic_cast<Program*>(parent)) {
+        memloc = new Location(gpRelative, codegen->globalOffset, GetName());
+        codegen->globalOffset += codegen->VarSize;
+    } else if (dynamic_cast<FnDecl*>(parent)) {
+        memloc = new Location(fpRelative, codegen->paramOffset, GetName());
+        codegen->paramOffset += codegen->VarSize;
+    } else if (!dynamic_cast<ClassDecl*>(parent)) {
+        memloc = new Location(fpRelative, codegen->localOffset, GetName());
+        codegen->localOffset -= codegen->VarSize;
+    }
 }
 
 
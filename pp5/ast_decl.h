@@ -15,6 +15,7 @@
 #include "ast.h"
 #include "list.h"
 #include "ast_type.h"
+#include <vector>
 
 class Type;
 class NamedType;
@@ -30,6 +31,7 @@ class Decl : public Node
   public:
     Decl(Identifier *name);
     const char* GetName() { return id->GetName(); }
+    Symbol GetSymbol() { return id->GetSymbol(); }
     friend std::ostream& operator<<(std::ostream& out, Decl *d) { return out << d->id; }
     Identifier *GetId() { return id; }
     Type* GetType() { return Type::errorType; }
@@ -44,7 +46,8 @@ class VarDecl : public Decl
   public:
     VarDecl(Identifier *name, Type *type);
     Type* GetType() { return type; }
-    void Emit(Scope* parentScope);
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class ClassDecl : public Decl 
@@ -54,21 +57,43 @@ class ClassDecl : public Decl
     NamedType *extends;
     List<NamedType*> *implements;
     List<InterfaceDecl*> *imp_decls;
+    ClassDecl *base;                  // the class extended, or NULL
+    bool preparing;                   // inside PrepareScope
+    List<ClassDecl*> *subclasses;
+    int preorder, postorder;          // see NumberHierarchy
+    std::vector<bool> interfaces;     // by InterfaceDecl::GetIndex
 
   public:
     ClassDecl(Identifier *name, NamedType *extends, 
               List<NamedType*> *implements, List<Decl*> *members);
     Scope* PrepareScope();
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
+
+         // Numbers the class tree depth first, so that the subclasses
+         // of a class are exactly the classes numbered between its
+         // preorder and postorder numbers, and gives each class the set
+         // of interfaces it implements, declared or inherited. Called
+         // once with all the decls of the program (see Program::Resolve),
+         // after which the two tests below are a few integer compares.
+    static void NumberHierarchy(List<Decl*> *decls);
+    bool IsSubclassOf(ClassDecl *other);
+    bool Implements(InterfaceDecl *other);
 };
 
 class InterfaceDecl : public Decl 
 {
   protected:
     List<Decl*> *members;
+    int index;   // numbers the interfaces from 0, see NumberHierarchy
     
   public:
     InterfaceDecl(Identifier *name, List<Decl*> *members);
     Scope* PrepareScope();
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
+    int GetIndex() { return index; }
+    void SetIndex(int i) { index = i; }
 };
 
 class FnDecl : public Decl 
@@ -77,10 +102,15 @@ class FnDecl : public Decl
     List<VarDecl*> *formals;
     Type *returnType;
     Stmt *body;
+    int localBytes;   // frame space for the locals, set by Resolve
     
   public:
     FnDecl(Identifier *name, Type *returnType, List<VarDecl*> *formals);
     void SetFunctionBody(Stmt *b);
+    Type *GetReturnType() { return returnType; }
+    List<VarDecl*> *GetFormals() { return formals; }
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
     virtual void Emit(Scope* parentScope);
     bool ConflictsWithPrevious(Decl*);
     bool MatchesPrototype(FnDecl* prototype);
@@ -5,6 +5,7 @@
 #include "ast_expr.h"
 #include "ast_type.h"
 #include "ast_decl.h"
+#include "errors.h"
 #include <string.h>
 
 #include <iostream>
@@ -12,19 +13,23 @@ using namespace std;
 
 IntConstant::IntConstant(yyltype loc, int val) : Expr(loc) {
     value = val;
+    type = Type::intType;
 }
 
 DoubleConstant::DoubleConstant(yyltype loc, double val) : Expr(loc) {
     value = val;
+    type = Type::doubleType;
 }
 
 BoolConstant::BoolConstant(yyltype loc, bool val) : Expr(loc) {
     value = val;
+    type = Type::boolType;
 }
 
 StringConstant::StringConstant(yyltype loc, const char *val) : Expr(loc) {
     Assert(val != NULL);
-    value = strdup(val);
+    value = Arena::Strdup(val);
+    type = Type::stringType;
 }
 
 Operator::Operator(yyltype loc, const char *tok) : Node(loc) {
@@ -59,6 +64,7 @@ FieldAccess::FieldAccess(Expr *b, Identifier *f)
     base = b; 
     if (base) base->SetParent(this); 
     (field=f)->SetParent(this);
+    decl = NULL;
 }
 
 
@@ -68,12 +74,14 @@ Call::Call(yyltype loc, Expr *b, Identifier *f, List<Expr*> *a) : Expr(loc)  {
     if (base) base->SetParent(this);
     (field=f)->SetParent(this);
     (actuals=a)->SetParentAll(this);
+    decl = NULL;
 }
  
 
 NewExpr::NewExpr(yyltype loc, NamedType *c) : Expr(loc) { 
   Assert(c != NULL);
   (cType=c)->SetParent(this);
+  type = cType->GetCanonical();
 }
 
 
@@ -83,6 +91,104 @@ NewArrayExpr::NewArrayExpr(yyltype loc, Expr *sz, Type *et) : Expr(loc) {
     (elemType=et)->SetParent(this);
 }
 
+/* Function: FindMember
+ * --------------------
+ * Returns the member named field of the class or interface that is the
+ * type of base, or NULL if base is not of a named type (or the name is
+ * not a member).
+ */
+static Decl *FindMember(Expr *base, Identifier *field) {
+    NamedType *type = dynamic_cast<NamedType*>(base->GetType());
+    Scope *members = type && type->GetDecl() ? type->GetDecl()->PrepareScope() : NULL;
+    return members ? members->Lookup(field) : NULL;
+}
+
+void CompoundExpr::Resolve(ScopeStack *scopes) {
+    if (left) left->Resolve(scopes);
+    right->Resolve(scopes);
+}
+
+void ArithmeticExpr::Resolve(ScopeStack *scopes) {
+    CompoundExpr::Resolve(scopes);
+    Type *r = right->GetType(), *l = left ? left->GetType() : r;
+    if (l->IsEquivalentTo(Type::doubleType) or r->IsEquivalentTo(Type::doubleType))
+        type = Type::doubleType;
+    else if (l->IsEquivalentTo(Type::intType) and r->IsEquivalentTo(Type::intType))
+        type = Type::intType;
+}
+
+void AssignExpr::Resolve(ScopeStack *scopes) {
+    CompoundExpr::Resolve(scopes);
+    type = left->GetType();
+    if (!right->GetType()->IsCompatibleWith(type))
+        ReportError::IncompatibleOperands(op, type, right->GetType());
+}
+
+void This::Resolve(ScopeStack *scopes) {
+    Node *n = parent;
+    while (n && !dynamic_cast<ClassDecl*>(n)) n = n->GetParent();
+    ClassDecl *cls = dynamic_cast<ClassDecl*>(n);
+    if (cls) type = NamedType::Get(cls->GetSymbol(), cls);
+}
+
+void ArrayAccess::Resolve(ScopeStack *scopes) {
+    base->Resolve(scopes);
+    subscript->Resolve(scopes);
+    ArrayType *array = dynamic_cast<ArrayType*>(base->GetType());
+    if (array) type = array->GetElemType();
+}
+
+void FieldAccess::Resolve(ScopeStack *scopes) {
+    if (base) {
+        base->Resolve(scopes);
+        decl = FindMember(base, field);
+    } else {
+        decl = scopes->Lookup(field);
+    }
+    if (decl) memloc = decl->GetMemoryLocation();
+    VarDecl *var = dynamic_cast<VarDecl*>(decl);
+    if (var) type = var->GetType()->GetCanonical();
+}
+
+void Call::Resolve(ScopeStack *scopes) {
+    if (base) {
+        base->Resolve(scopes);
+        decl = FindMember(base, field);
+    } else {
+        decl = scopes->Lookup(field);
+    }
+    for (int n = 0; n < actuals->NumElements(); n++)
+        actuals->Nth(n)->Resolve(scopes);
+    FnDecl *fn = dynamic_cast<FnDecl*>(decl);
+    if (fn) {
+        type = fn->GetReturnType()->GetCanonical();
+        List<VarDecl*> *formals = fn->GetFormals();
+        if (formals->NumElements() != actuals->NumElements()) {
+            ReportError::NumArgsMismatch(field, formals->NumElements(), actuals->NumElements());
+        } else {
+            for (int n = 0; n < actuals->NumElements(); n++) {
+                Type *given = actuals->Nth(n)->GetType();
+                Type *expected = formals->Nth(n)->GetType();
+                if (!given->IsCompatibleWith(expected))
+                    ReportError::ArgMismatch(actuals->Nth(n), n + 1, given, expected);
+            }
+        }
+    } else if (base && dynamic_cast<ArrayType*>(base->GetType())
+             && strcmp(field->GetName(), "length") == 0)
+        type = Type::intType;
+}
+
+void NewExpr::Resolve(ScopeStack *scopes) {
+    cType->Resolve(scopes);
+    type = cType->GetCanonical();
+}
+
+void NewArrayExpr::Resolve(ScopeStack *scopes) {
+    size->Resolve(scopes);
+    elemType->Resolve(scopes);
+    type = elemType->GetCanonical()->GetArrayType();
+}
+
 void IntConstant::Emit(Scope* parentScope) {
     nodeScope = parentScope;
     memloc = CodeGenerator::getInstance()->GenLoadConstant(value);
@@ -120,20 +226,6 @@ void FieldAccess::Emit(Scope* parentScope) {
     if (base) {
         // object handling
     }
-    VarDecl* decl = dynamic_cast<VarDecl*>(FindDecl(field, kDeep));
-    decl->Emit(nodeScope); // this decl should already have been emitted, it doesn't have memloc info, though?
-    memloc = decl->GetMemoryLocation();
-}
-
-Type* ArithmeticExpr::GetType() {
-    if (left->GetType()->IsEquivalentTo(Type::doubleType) or right->GetType()->IsEquivalentTo(Type::doubleType))
-        return Type::doubleType;
-    if (left->GetType()->IsEquivalentTo(Type::intType) and right->GetType()->IsEquivalentTo(Type::intType))
-        return Type::intType;
-    else return Type::errorType;
-}
-
-Type* FieldAccess::GetType() {
-    return (dynamic_cast<VarDecl*>(FindDecl(field, kDeep)))->GetType();
+    // memloc is the variable's storage, found by Resolve
 }
       
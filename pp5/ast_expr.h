@@ -22,12 +22,22 @@ class NamedType; // for new
 class Type; // for NewArray
 
 
+// An Expr's type is worked out once, bottom up: by the constructor
+// when it is fixed (constants and the like), otherwise by Resolve, once
+// the operands have theirs. GetType just reads it back.
 class Expr : public Stmt 
 {
+  protected:
+    Type *type;
+
   public:
-    Expr(yyltype loc) : Stmt(loc) {}
-    Expr() : Stmt() {}
-    virtual Type* GetType() { return Type::errorType; }
+    Expr(yyltype loc) : Stmt(loc) { type = Type::errorType; }
+    Expr() : Stmt() { type = Type::errorType; }
+    Type* GetType() { return type; }
+
+         // Adds a node of the given kind for this expression to the
+         // flat tree, with its type but no children.
+    NodeRef AddTo(FlatAst *ast, FlatKind kind);
 };
 
 /* This node type is used for those places where an expression is optional.
@@ -36,6 +46,8 @@ class Expr : public Stmt
 class EmptyExpr : public Expr
 {
   public:
+    EmptyExpr() : Expr() { type = Type::voidType; }
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kEmptyExpr); }
 };
 
 class IntConstant : public Expr 
@@ -45,8 +57,8 @@ class IntConstant : public Expr
   
   public:
     IntConstant(yyltype loc, int val);
-    Type* GetType() { return Type::intType; }
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class DoubleConstant : public Expr 
@@ -56,7 +68,7 @@ class DoubleConstant : public Expr
     
   public:
     DoubleConstant(yyltype loc, double val);
-    // Type* GetType() { return Type::doubleType; } // double types don't exist in pp5
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class BoolConstant : public Expr 
@@ -66,8 +78,8 @@ class BoolConstant : public Expr
     
   public:
     BoolConstant(yyltype loc, bool val);
-    Type * GetType() { return Type::boolType; } // are we treating bools as ints? should I return intType?
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class StringConstant : public Expr 
@@ -77,15 +89,15 @@ class StringConstant : public Expr
     
   public:
     StringConstant(yyltype loc, const char *val);
-    Type* GetType() { return Type::stringType; }
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class NullConstant: public Expr 
 {
   public: 
-    NullConstant(yyltype loc) : Expr(loc) {}
-    Type* GetType() { return Type::nullType; } // necessary?
+    NullConstant(yyltype loc) : Expr(loc) { type = Type::nullType; }
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kNullConstant); }
 };
 
 class Operator : public Node 
@@ -108,8 +120,9 @@ class CompoundExpr : public Expr
   public:
     CompoundExpr(Expr *lhs, Operator *op, Expr *rhs); // for binary
     CompoundExpr(Operator *op, Expr *rhs);             // for unary
-    // what type do we get here? does it depend on the type of the expressions?
+    void Resolve(ScopeStack *scopes);
     void Emit(Scope* parentScope);
+    NodeRef FlattenAs(FlatAst *ast, FlatKind kind);
 };
 
 class ArithmeticExpr : public CompoundExpr 
@@ -117,32 +130,32 @@ class ArithmeticExpr : public CompoundExpr
   public:
     ArithmeticExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
     ArithmeticExpr(Operator *op, Expr *rhs) : CompoundExpr(op,rhs) {}
-    Type* GetType();
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast) { return FlattenAs(ast, kArithmeticExpr); }
 };
 
 class RelationalExpr : public CompoundExpr 
 {
   public:
-    RelationalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
-    Type* GetType() { return Type::boolType; }
+    RelationalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) { type = Type::boolType; }
+    NodeRef Flatten(FlatAst *ast) { return FlattenAs(ast, kRelationalExpr); }
 };
 
 class EqualityExpr : public CompoundExpr 
 {
   public:
-    EqualityExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
+    EqualityExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) { type = Type::boolType; }
     const char *GetPrintNameForNode() { return "EqualityExpr"; }
-    Type* GetType() { return Type::boolType; }
+    NodeRef Flatten(FlatAst *ast) { return FlattenAs(ast, kEqualityExpr); }
 };
 
 class LogicalExpr : public CompoundExpr 
 {
   public:
-    LogicalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
-    LogicalExpr(Operator *op, Expr *rhs) : CompoundExpr(op,rhs) {}
+    LogicalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) { type = Type::boolType; }
+    LogicalExpr(Operator *op, Expr *rhs) : CompoundExpr(op,rhs) { type = Type::boolType; }
     const char *GetPrintNameForNode() { return "LogicalExpr"; }
-    Type* GetType() { return Type::boolType; }
-    
+    NodeRef Flatten(FlatAst *ast) { return FlattenAs(ast, kLogicalExpr); }
 };
 
 class AssignExpr : public CompoundExpr 
@@ -150,7 +163,9 @@ class AssignExpr : public CompoundExpr
   public:
     AssignExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
     const char *GetPrintNameForNode() { return "AssignExpr"; }
+    void Resolve(ScopeStack *scopes);
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast) { return FlattenAs(ast, kAssignExpr); }
 };
 
 class LValue : public Expr 
@@ -164,6 +179,8 @@ class This : public Expr
 {
   public:
     This(yyltype loc) : Expr(loc) {}
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kThis); }
 };
 
 class ArrayAccess : public LValue 
@@ -173,7 +190,8 @@ class ArrayAccess : public LValue
     
   public:
     ArrayAccess(yyltype loc, Expr *base, Expr *subscript);
-    Type* GetType() { return dynamic_cast<ArrayType*>(base->GetType())->GetElemType(); }
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 /* Note that field access is used both for qualified names
@@ -186,11 +204,14 @@ class FieldAccess : public LValue
   protected:
     Expr *base;	// will be NULL if no explicit base
     Identifier *field;
+    Decl *decl;   // set by Resolve, which also sets memloc
     
   public:
     FieldAccess(Expr *base, Identifier *field); //ok to pass NULL base
+    void Resolve(ScopeStack *scopes);
+    Decl *GetDecl() { return decl; }
     void Emit(Scope* parentScope);
-    Type* GetType();
+    NodeRef Flatten(FlatAst *ast);
 };
 
 /* Like field access, call is used both for qualified base.field()
@@ -203,10 +224,13 @@ class Call : public Expr
     Expr *base;	// will be NULL if no explicit base
     Identifier *field;
     List<Expr*> *actuals;
+    Decl *decl;   // the function or method called, set by Resolve
     
   public:
     Call(yyltype loc, Expr *base, Identifier *field, List<Expr*> *args);
-    // GetType() depends on the field, where do we get the type of an ident?
+    void Resolve(ScopeStack *scopes);
+    Decl *GetDecl() { return decl; }
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class NewExpr : public Expr
@@ -216,7 +240,8 @@ class NewExpr : public Expr
     
   public:
     NewExpr(yyltype loc, NamedType *clsType);
-    Type* GetType() { return cType; }
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kNewExpr); }
 };
 
 class NewArrayExpr : public Expr
@@ -227,19 +252,22 @@ class NewArrayExpr : public Expr
     
   public:
     NewArrayExpr(yyltype loc, Expr *sizeExpr, Type *elemType);
-    Type* GetType() { return elemType; }
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class ReadIntegerExpr : public Expr
 {
   public:
-    ReadIntegerExpr(yyltype loc) : Expr(loc) {}
+    ReadIntegerExpr(yyltype loc) : Expr(loc) { type = Type::intType; }
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kReadIntegerExpr); }
 };
 
 class ReadLineExpr : public Expr
 {
   public:
-    ReadLineExpr(yyltype loc) : Expr (loc) {}
+    ReadLineExpr(yyltype loc) : Expr (loc) { type = Type::stringType; }
+    NodeRef Flatten(FlatAst *ast) { return AddTo(ast, kReadLineExpr); }
 };
 
     
@@ -26,8 +26,23 @@ Program::Program(List<Decl*> *d) {
 void Program::Check() {
     // Assume valid programs
 }
+
+void Program::Resolve(ScopeStack *scopes) {
+    ScopeStack stack;
+    if (!scopes) scopes = &stack;
+    scopes->Push(nodeScope);
+    ClassDecl::NumberHierarchy(decls);
+    for (int n = 0; n < decls->NumElements(); n++)
+        decls->Nth(n)->Resolve(scopes);
+    scopes->Pop();
+}
+
 void Program::Emit(Scope* parentScope) {
-    nodeScope = new Scope();
+    if (ReportError::NumErrors() > 0) return; // found by Resolve
+    if (IsDebugOn("flat")) { // print the flat tree instead of compiling
+        FlatAst(this).Print();
+        return;
+    }
     for (int n = 0; n < decls->NumElements(); n++) {
         decls->Nth(n)->Emit(nodeScope);
     }
@@ -41,14 +56,21 @@ StmtBlock::StmtBlock(List<VarDecl*> *d, List<Stmt*> *s) {
     (stmts=s)->SetParentAll(this);
 }
 
-void StmtBlock::Emit(Scope* parentScope) {
+void StmtBlock::Resolve(ScopeStack *scopes) {
     nodeScope = new Scope();
     decls->DeclareAll(nodeScope);
-    // emit each decl and statement
+    scopes->Push(nodeScope);
+    for (int n = 0; n < decls->NumElements(); n++)
+        decls->Nth(n)->Resolve(scopes);
+    for (int n = 0; n < stmts->NumElements(); n++)
+        stmts->Nth(n)->Resolve(scopes);
+    scopes->Pop();
+}
+
+void StmtBlock::Emit(Scope* parentScope) {
+    // the decls already have their storage (see VarDecl::Resolve)
     for (int n = 0; n < stmts->NumElements(); n++)
         stmts->Nth(n)->Emit(nodeScope);
-    for (int n2 = 0; n2 < decls->NumElements(); n2++)
-        decls->Nth(n2)->Emit(nodeScope);
 }
 
 ConditionalStmt::ConditionalStmt(Expr *t, Stmt *b) { 
@@ -57,29 +79,59 @@ ConditionalStmt::ConditionalStmt(Expr *t, Stmt *b) {
     (body=b)->SetParent(this);
 }
 
+void ConditionalStmt::Resolve(ScopeStack *scopes) {
+    test->Resolve(scopes);
+    body->Resolve(scopes);
+}
+
 ForStmt::ForStmt(Expr *i, Expr *t, Expr *s, Stmt *b): LoopStmt(t, b) { 
     Assert(i != NULL && t != NULL && s != NULL && b != NULL);
     (init=i)->SetParent(this);
     (step=s)->SetParent(this);
 }
 
+void ForStmt::Resolve(ScopeStack *scopes) {
+    init->Resolve(scopes);
+    step->Resolve(scopes);
+    LoopStmt::Resolve(scopes);
+}
+
 IfStmt::IfStmt(Expr *t, Stmt *tb, Stmt *eb): ConditionalStmt(t, tb) { 
     Assert(t != NULL && tb != NULL); // else can be NULL
     elseBody = eb;
     if (elseBody) elseBody->SetParent(this);
 }
 
+void IfStmt::Resolve(ScopeStack *scopes) {
+    ConditionalStmt::Resolve(scopes);
+    if (elseBody) elseBody->Resolve(scopes);
+}
+
 
 ReturnStmt::ReturnStmt(yyltype loc, Expr *e) : Stmt(loc) { 
     Assert(e != NULL);
     (expr=e)->SetParent(this);
 }
+
+void ReturnStmt::Resolve(ScopeStack *scopes) {
+    expr->Resolve(scopes);
+    Node *n = parent;
+    while (n && !dynamic_cast<FnDecl*>(n)) n = n->GetParent();
+    FnDecl *fn = dynamic_cast<FnDecl*>(n);
+    if (fn && !expr->GetType()->IsCompatibleWith(fn->GetReturnType()))
+        ReportError::ReturnMismatch(this, expr->GetType(), fn->GetReturnType());
+}
   
 PrintStmt::PrintStmt(List<Expr*> *a) {    
     Assert(a != NULL);
     (args=a)->SetParentAll(this);
 }
 
+void PrintStmt::Resolve(ScopeStack *scopes) {
+    for (int n = 0; n < args->NumElements(); n++)
+        args->Nth(n)->Resolve(scopes);
+}
+
 void PrintStmt::Emit(Scope* parentScope) {
     nodeScope = parentScope;
     // generate loads for argument expressions to put params on the stack
@@ -109,7 +161,7 @@ void PrintStmt::Emit(Scope* parentScope) {
 }
 
 void IfStmt::Emit(Scope* parentScope) {
-    nodeScope = new Scope();
+    nodeScope = parentScope;
     CodeGenerator *codegen = CodeGenerator::getInstance();
     char* else_label = codegen->NewLabel();
     test->Emit(nodeScope); // store test expression in a temporary variable
@@ -118,12 +170,12 @@ void IfStmt::Emit(Scope* parentScope) {
     char* after_label = codegen->NewLabel();
     codegen->GenGoto(after_label); // skip over the else body if test was true
     codegen->GenLabel(else_label);
-    if (elseBody) elseBody->Emit(new Scope());
+    if (elseBody) elseBody->Emit(nodeScope);
     codegen->GenLabel(after_label);
 }
 
 void WhileStmt::Emit(Scope* parentScope) {
-    nodeScope = new Scope();
+    nodeScope = parentScope;
     CodeGenerator *codegen = CodeGenerator::getInstance();
     char* before_label = codegen->NewLabel();
     char* after_label = codegen->NewLabel();
@@ -32,7 +32,13 @@ class Program : public Node
   public:
      Program(List<Decl*> *declList);
      void Check();
+          // The name resolution pass over the whole program, run
+          // between Check and Emit. It also reports assignments,
+          // arguments and return values of incompatible types, in
+          // which case Emit does nothing.
+     void Resolve(ScopeStack *scopes = NULL);
      void Emit(Scope* parentScope=NULL);
+     NodeRef Flatten(FlatAst *ast);
      bool hasMain;
 };
 
@@ -51,8 +57,10 @@ class StmtBlock : public Stmt
     
   public:
     StmtBlock(List<VarDecl*> *variableDeclarations, List<Stmt*> *statements);
+    void Resolve(ScopeStack *scopes);
     virtual void Emit(Scope* parentScope);
     void Declare(Scope* scope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
   
@@ -64,6 +72,7 @@ class ConditionalStmt : public Stmt
   
   public:
     ConditionalStmt(Expr *testExpr, Stmt *body);
+    void Resolve(ScopeStack *scopes);
 };
 
 class LoopStmt : public ConditionalStmt 
@@ -80,6 +89,8 @@ class ForStmt : public LoopStmt
   
   public:
     ForStmt(Expr *init, Expr *test, Expr *step, Stmt *body);
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class WhileStmt : public LoopStmt 
@@ -87,6 +98,7 @@ class WhileStmt : public LoopStmt
   public:
     WhileStmt(Expr *test, Stmt *body) : LoopStmt(test, body) { }
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class IfStmt : public ConditionalStmt 
@@ -96,13 +108,16 @@ class IfStmt : public ConditionalStmt
   
   public:
     IfStmt(Expr *test, Stmt *thenBody, Stmt *elseBody);
+    void Resolve(ScopeStack *scopes);
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class BreakStmt : public Stmt 
 {
   public:
     BreakStmt(yyltype loc) : Stmt(loc) {}
+    NodeRef Flatten(FlatAst *ast) { return ast->Add(kBreakStmt, location); }
 };
 
 class ReturnStmt : public Stmt  
@@ -112,6 +127,8 @@ class ReturnStmt : public Stmt
   
   public:
     ReturnStmt(yyltype loc, Expr *expr);
+    void Resolve(ScopeStack *scopes);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class PrintStmt : public Stmt
@@ -121,7 +138,9 @@ class PrintStmt : public Stmt
     
   public:
     PrintStmt(List<Expr*> *arguments);
+    void Resolve(ScopeStack *scopes);
     void Emit(Scope* parentScope);
+    NodeRef Flatten(FlatAst *ast);
 };
 
 
@@ -5,6 +5,7 @@
 #include "ast_type.h"
 #include "ast_decl.h"
 #include <string.h>
+#include <stdio.h>
 
  
 /* Class constants
@@ -25,18 +26,80 @@ Type *Type::errorType  = new Type("error");
 
 Type::Type(const char *n) {
     Assert(n);
-    typeName = strdup(n);
+    typeName = Arena::Strdup(n);
+    arrayOf = NULL;
 }
 
+bool Type::IsCompatibleWith(Type *other) {
+    Type *self = GetCanonical();
+    other = other->GetCanonical();
+    if (self == other || self == errorType || other == errorType) return true;
+    NamedType *to = dynamic_cast<NamedType*>(other);
+    if (!to) return false;
+    if (self == nullType || !to->GetDecl()) return true;
+    NamedType *from = dynamic_cast<NamedType*>(self);
+    if (from && !from->GetDecl()) return true;
+    ClassDecl *cls = from ? dynamic_cast<ClassDecl*>(from->GetDecl()) : NULL;
+    if (!cls) return false;
+    if (ClassDecl *super = dynamic_cast<ClassDecl*>(to->GetDecl()))
+        return cls->IsSubclassOf(super);
+    if (InterfaceDecl *in = dynamic_cast<InterfaceDecl*>(to->GetDecl()))
+        return cls->Implements(in);
+    return false;
+}
+
+ArrayType *Type::GetArrayType() {
+    if (!arrayOf) arrayOf = new ArrayType(this);
+    return arrayOf;
+}
+
+Hashtable<NamedType*> *NamedType::table = NULL;
+
 NamedType::NamedType(Identifier *i) : Type(*i->GetLocation()) {
     Assert(i != NULL);
     (id=i)->SetParent(this);
+    decl = NULL;
 } 
 
+NamedType *NamedType::Get(Symbol name, Decl *decl) {
+    static const yyltype noLocation = {0, 0, 0, 0, 0, NULL};
+    if (!table) table = new Hashtable<NamedType*>;
+    NamedType *type = table->Lookup(name);
+    if (!type) {
+        type = new NamedType(new Identifier(noLocation, name));
+        table->Enter(name, type);
+    }
+    if (!type->decl) type->decl = decl;
+    return type;
+}
+
+// Class and interface names are global, so every use of a name
+// resolves to the same decl, and the first one binds the canonical
+// type for all of them.
+void NamedType::Resolve(ScopeStack *scopes) {
+    decl = scopes->Lookup(id);
+    Get(id->GetSymbol(), decl);
+}
+
 
 ArrayType::ArrayType(yyltype loc, Type *et) : Type(loc) {
     Assert(et != NULL);
     (elemType=et)->SetParent(this);
 }
 
+// The canonical array type is shared, so elemType keeps its own parent.
+ArrayType::ArrayType(Type *et) {
+    Assert(et != NULL);
+    elemType = et;
+}
+
+const char *ArrayType::GetAliasClass() {
+    if (!typeName) {
+        const char *elem = elemType->GetAliasClass();
+        typeName = (char *)Arena::Allocate(strlen(elem) + 3);
+        sprintf(typeName, "%s[]", elem);
+    }
+    return typeName;
+}
+
 
@@ -5,6 +5,14 @@
  * for built-in types, the NamedType for classes and interfaces,
  * and the ArrayType for arrays of other types.  
  *
+ * Each place a class, interface or array type is written has a node
+ * of its own in the tree, with its location and parent. What the type
+ * stands for is its canonical type (see GetCanonical): one NamedType
+ * per class or interface name and one ArrayType per element type,
+ * outside the tree and shared by every use. Expressions carry
+ * canonical types, and two types are equivalent exactly when their
+ * canonical types are the same object.
+ *
  * pp5: You will need to extend the Type classes to implement
  * code generation for types.
  */
@@ -16,45 +24,89 @@
 #include "list.h"
 #include <iostream>
 
+class ArrayType;
+
 class Type : public Node 
 {
   protected:
     char *typeName;
+    ArrayType *arrayOf;   // made by GetArrayType
+
+    Type() { typeName = NULL; arrayOf = NULL; }
 
   public :
     static Type *intType, *doubleType, *boolType, *voidType,
                 *nullType, *stringType, *errorType;
 
-    Type(yyltype loc) : Node(loc) {}
+    Type(yyltype loc) : Node(loc) { typeName = NULL; arrayOf = NULL; }
     Type(const char *str);
     
     virtual void PrintToStream(std::ostream& out) { out << typeName; }
     friend std::ostream& operator<<(std::ostream& out, Type *t) { t->PrintToStream(out); return out; }
-    virtual bool IsEquivalentTo(Type *other) { return this == other; }
+
+         // The built-in types are their own canonical types.
+    virtual Type *GetCanonical() { return this; }
+    bool IsEquivalentTo(Type *other) { return GetCanonical() == other->GetCanonical(); }
+
+         // Whether a value of this type can be used where one of type
+         // other is expected: the same type, null for an object, or a
+         // class for a superclass or an interface it implements. Types
+         // not worked out (errorType, or a name not bound to a decl)
+         // are taken to be compatible, so as not to report an error
+         // that isn't there.
+    bool IsCompatibleWith(Type *other);
+
+         // Returns the canonical array type with this, a canonical
+         // type, as its element type, made on first request.
+    ArrayType *GetArrayType();
+
+         // Name used to tag loads and stores for the optimizer's
+         // type-based alias analysis (see GenLoad in codegen.h).
+    virtual const char *GetAliasClass() { return typeName; }
 };
 
 class NamedType : public Type 
 {
   protected:
     Identifier *id;
+    Decl *decl;   // the class or interface, once resolved
+    static Hashtable<NamedType*> *table;   // the canonical types, by name
     
   public:
     NamedType(Identifier *i);
+
+         // Returns the canonical NamedType for name, made on first
+         // request. It is bound to the class or interface the first
+         // time a use of the name is resolved, or when given decl.
+    static NamedType *Get(Symbol name, Decl *decl = NULL);
+
     Identifier* GetId() { return id; }
+    Decl *GetDecl() { return decl; }
+    Type *GetCanonical() { return Get(id->GetSymbol()); }
+    void Resolve(ScopeStack *scopes);
     
     void PrintToStream(std::ostream& out) { out << id; }
+    const char *GetAliasClass() { return id->GetName(); }
+    NodeRef Flatten(FlatAst *ast);
 };
 
 class ArrayType : public Type 
 {
+  friend class Type;
+
   protected:
     Type *elemType;
 
+    ArrayType(Type *elemType);
+
   public:
     ArrayType(yyltype loc, Type *elemType);
     Type* GetElemType() { return elemType; }	
+    Type *GetCanonical() { return elemType->GetCanonical()->GetArrayType(); }
+    void Resolve(ScopeStack *scopes) { elemType->Resolve(scopes); }
     
     void PrintToStream(std::ostream& out) { out << elemType << "[]"; }
+    const char *GetAliasClass();
 };
 
  
@@ -0,0 +1,99 @@
+/* File: callgraph.cc
+ * ------------------
+ * Whole-program elimination of functions, methods and vtables that
+ * can never be used.
+ *
+ * Starting from main, a function is reachable if a reachable function
+ * calls it with LCall or takes its address with LoadLabel. Methods are
+ * only called through ACall, where the target is not known statically,
+ * so instead we find the classes that can be instantiated: a class is
+ * instantiated exactly when reachable code loads the label of its
+ * vtable (New stores it into the new object). Every method in the
+ * vtable of an instantiated class is reachable, including those it
+ * provides for interfaces; the vtable of a class that is never
+ * instantiated is not needed at all.
+ */
+
+#include "optimizer.h"
+#include <string>
+
+using std::string;
+
+    // The instructions of a function, from its Label to its EndFunc
+struct FunctionRange {
+  std::list<Instruction*>::iterator first, last;
+};
+
+
+/* Function: Reach
+ * ---------------
+ * Marks label as used, queueing it for a scan if it names a function
+ * and, if it names a vtable, queueing each of its methods in turn.
+ */
+static void Reach(const char *label, std::set<string> *used,
+                  std::map<string, FunctionRange> &functions,
+                  std::map<string, VTable*> &vtables,
+                  std::vector<string> *worklist)
+{
+  if (!used->insert(label).second) return;
+  if (functions.count(label)) worklist->push_back(label);
+  if (vtables.count(label)) {
+    List<const char *> *methods = vtables[label]->GetMethodLabels();
+    for (int i = 0; i < methods->NumElements(); i++)
+      Reach(methods->Nth(i), used, functions, vtables, worklist);
+    methods = vtables[label]->GetSelectorMethods();
+    for (int i = 0; i < methods->NumElements(); i++)
+      Reach(methods->Nth(i), used, functions, vtables, worklist);
+  }
+}
+
+
+/* Function: EliminateDeadFunctions
+ * --------------------------------
+ * Builds the label-to-function and label-to-vtable maps, walks the call
+ * graph from main and erases what was never reached. A program without
+ * main is left alone; the front end has already reported it.
+ */
+void EliminateDeadFunctions(std::list<Instruction*> *code)
+{
+  std::map<string, FunctionRange> functions;
+  std::map<string, VTable*> vtables;
+  std::list<Instruction*>::iterator p, prev = code->end();
+  for (p = code->begin(); p != code->end(); prev = p++) {
+    if (VTable *vt = dynamic_cast<VTable*>(*p))
+      vtables[vt->GetLabel()] = vt;
+    if (!dynamic_cast<BeginFunc*>(*p) || prev == code->end()) continue;
+    Label *label = dynamic_cast<Label*>(*prev);
+    if (!label) continue;
+    FunctionRange range;
+    range.first = prev;
+    range.last = p;
+    while (range.last != code->end() && !dynamic_cast<EndFunc*>(*range.last))
+      ++range.last;
+    Assert(range.last != code->end());
+    functions[label->text()] = range;
+  }
+  if (!functions.count("main")) return;
+
+  std::set<string> used;
+  std::vector<string> worklist;
+  Reach("main", &used, functions, vtables, &worklist);
+  while (!worklist.empty()) {
+    FunctionRange range = functions[worklist.back()];
+    worklist.pop_back();
+    for (p = range.first; p != range.last; ++p) {
+      if (LCall *lc = dynamic_cast<LCall*>(*p))
+        Reach(lc->GetLabel(), &used, functions, vtables, &worklist);
+      else if (LoadLabel *ll = dynamic_cast<LoadLabel*>(*p))
+        Reach(ll->GetLabel(), &used, functions, vtables, &worklist);
+    }
+  }
+
+  for (std::map<string, FunctionRange>::iterator f = functions.begin();
+       f != functions.end(); ++f)
+    if (!used.count(f->first))
+      code->erase(f->second.first, ++f->second.last);
+  for (std::map<string, VTable*>::iterator v = vtables.begin(); v != vtables.end(); ++v)
+    if (!used.count(v->first))
+      code->remove(v->second);
+}
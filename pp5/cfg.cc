@@ -0,0 +1,207 @@
+/* File: cfg.cc
+ * ------------
+ * Implementation of the BasicBlock and FlowGraph classes.
+ */
+
+#include "cfg.h"
+#include "codegen.h"
+#include <algorithm>
+#include <string>
+#include <string.h>
+
+
+static bool EndsBlock(Instruction *instr)
+{
+  return dynamic_cast<Goto*>(instr) || dynamic_cast<IfZ*>(instr)
+      || dynamic_cast<Return*>(instr);
+}
+
+
+const char *BasicBlock::GetLabel()
+{
+  Label *label = code.empty() ? NULL : dynamic_cast<Label*>(code.front());
+  return label ? label->text() : NULL;
+}
+
+
+/* Constructor
+ * -----------
+ * Walks the instructions once, opening a new block at each Label and
+ * after each branch or return. A function always has at least one
+ * (possibly empty) entry block.
+ */
+FlowGraph::FlowGraph(BeginFunc *b, std::list<Instruction*>::iterator first,
+                     std::list<Instruction*>::iterator last) : begin(b)
+{
+  BasicBlock *cur = NULL;
+  for (std::list<Instruction*>::iterator p = first; p != last; ++p) {
+    if (!cur || (dynamic_cast<Label*>(*p) && !cur->code.empty())) {
+      cur = new BasicBlock(blocks.size());
+      blocks.push_back(cur);
+    }
+    cur->code.push_back(*p);
+    if (EndsBlock(*p)) cur = NULL;
+  }
+  if (blocks.empty()) blocks.push_back(new BasicBlock(0));
+  ComputeEdges();
+}
+
+
+BasicBlock *FlowGraph::BlockForLabel(const char *label)
+{
+  for (int i = 0; i < NumBlocks(); i++) {
+    const char *l = blocks[i]->GetLabel();
+    if (l && !strcmp(l, label)) return blocks[i];
+  }
+  return NULL;
+}
+
+
+/* Method: ComputeEdges
+ * --------------------
+ * Goto has a single edge to its target, IfZ has the fall through edge
+ * plus one to its target, Return has none and anything else falls
+ * through to the next block in the layout.
+ */
+void FlowGraph::ComputeEdges()
+{
+  std::map<std::string, BasicBlock*> labels;
+  for (int i = 0; i < NumBlocks(); i++) {
+    blocks[i]->num = i;
+    blocks[i]->succs.clear();
+    blocks[i]->preds.clear();
+    if (blocks[i]->GetLabel()) labels[blocks[i]->GetLabel()] = blocks[i];
+  }
+  for (int i = 0; i < NumBlocks(); i++) {
+    BasicBlock *b = blocks[i];
+    Instruction *last = b->Last();
+    const char *target = NULL;
+    bool fallsThrough = true;
+    if (Goto *g = dynamic_cast<Goto*>(last)) {
+      target = g->branch_label();
+      fallsThrough = false;
+    } else if (IfZ *ifz = dynamic_cast<IfZ*>(last)) {
+      target = ifz->branch_label();
+    } else if (dynamic_cast<Return*>(last)) {
+      fallsThrough = false;
+    }
+    if (fallsThrough && i + 1 < NumBlocks())
+      b->succs.push_back(blocks[i+1]);
+    if (target) {
+      Assert(labels.count(target));
+      BasicBlock *t = labels[target];
+      if (b->succs.empty() || b->succs[0] != t)
+        b->succs.push_back(t);
+    }
+    for (int j = 0; j < b->succs.size(); j++)
+      b->succs[j]->preds.push_back(b);
+  }
+}
+
+
+void FlowGraph::ReversePostorder(std::vector<BasicBlock*> *order)
+{
+  std::vector<bool> visited(NumBlocks(), false);
+  std::vector<std::pair<BasicBlock*, int> > stack;  // block, next succ to visit
+  order->clear();
+  stack.push_back(std::make_pair(Entry(), 0));
+  visited[0] = true;
+  while (!stack.empty()) {
+    BasicBlock *b = stack.back().first;
+    int i = stack.back().second++;
+    if (i < b->succs.size()) {
+      BasicBlock *s = b->succs[i];
+      if (!visited[s->num]) {
+        visited[s->num] = true;
+        stack.push_back(std::make_pair(s, 0));
+      }
+    } else {
+      order->push_back(b);
+      stack.pop_back();
+    }
+  }
+  std::reverse(order->begin(), order->end());
+}
+
+
+void FlowGraph::StepLiveness(Instruction *instr, LocationSet *live)
+{
+  Location *srcs[Instruction::MaxSrcs];
+  if (instr->GetDst()) live->erase(instr->GetDst());
+  int n = instr->GetSrcs(srcs);
+  for (int i = 0; i < n; i++)
+    live->insert(srcs[i]);
+}
+
+
+/* Method: ComputeLiveOut
+ * ----------------------
+ * The usual backward iteration to a fixed point: a location is live
+ * on exit from a block if it is live on entry to any successor.
+ */
+void FlowGraph::ComputeLiveOut(std::vector<LocationSet> *liveOut)
+{
+  std::vector<LocationSet> liveIn(NumBlocks());
+  liveOut->assign(NumBlocks(), LocationSet());
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = NumBlocks() - 1; k >= 0; k--) {
+      BasicBlock *b = blocks[k];
+      LocationSet live;
+      for (int i = 0; i < b->succs.size(); i++) {
+        LocationSet &in = liveIn[b->succs[i]->num];
+        live.insert(in.begin(), in.end());
+      }
+      (*liveOut)[k] = live;
+      for (int i = b->code.size() - 1; i >= 0; i--)
+        StepLiveness(b->code[i], &live);
+      if (live.size() != liveIn[k].size()) {
+        liveIn[k] = live;
+        changed = true;
+      }
+    }
+  }
+}
+
+
+void FlowGraph::RemoveBlocks(const std::vector<bool> &keep)
+{
+  std::vector<BasicBlock*> kept;
+  for (int i = 0; i < NumBlocks(); i++)
+    if (i == 0 || keep[i]) kept.push_back(blocks[i]);
+  blocks = kept;
+  ComputeEdges();
+}
+
+
+/* Method: NewTemp
+ * ---------------
+ * The new temporary goes just below the last local of the frame, using
+ * the CodeGenerator so temp names stay unique across the program.
+ */
+Location *FlowGraph::NewTemp()
+{
+  CodeGenerator *codegen = CodeGenerator::getInstance();
+  int frameSize = begin->GetFrameSize();
+  codegen->localOffset = CodeGenerator::OffsetToFirstLocal - frameSize;
+  Location *result = codegen->GenTempVar();
+  begin->SetFrameSize(frameSize + CodeGenerator::VarSize);
+  return result;
+}
+
+
+int FlowGraph::ReserveFrameSpace(int numBytes)
+{
+  Assert(numBytes > 0 && numBytes % CodeGenerator::VarSize == 0);
+  int frameSize = begin->GetFrameSize() + numBytes;
+  begin->SetFrameSize(frameSize);
+  return CodeGenerator::OffsetToFirstLocal + CodeGenerator::VarSize - frameSize;
+}
+
+
+void FlowGraph::Linearize(std::list<Instruction*> *out)
+{
+  for (int i = 0; i < NumBlocks(); i++)
+    out->insert(out->end(), blocks[i]->code.begin(), blocks[i]->code.end());
+}
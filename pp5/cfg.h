@@ -0,0 +1,100 @@
+/* File: cfg.h
+ * -----------
+ * The FlowGraph class partitions the Tac instructions of a single
+ * function into basic blocks and records the control flow edges
+ * between them. It is the common ground for the passes declared in
+ * optimizer.h: a pass inspects and rewrites the instructions of each
+ * block, and the graph is then laid back out as a flat sequence.
+ *
+ * A block starts at a Label (or right after a branch or return) and
+ * ends with the next Goto, IfZ or Return, or just before the next
+ * Label. The Label and BeginFunc that open a function and the EndFunc
+ * that closes it are left outside the graph.
+ */
+
+#ifndef _H_cfg
+#define _H_cfg
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+#include "tac.h"
+
+
+    // Orders Locations by the storage they name (segment and offset)
+    // rather than by object identity, so that two Location objects for
+    // the same stack or global slot are treated as one variable.
+struct LocationLess {
+  bool operator()(Location *a, Location *b) const
+  { return a->GetSegment() != b->GetSegment() ? a->GetSegment() < b->GetSegment()
+                                              : a->GetOffset() < b->GetOffset(); }
+};
+
+typedef std::set<Location*, LocationLess> LocationSet;
+
+
+class BasicBlock {
+  public:
+    int num;                          // index in the function's layout
+    std::vector<Instruction*> code;
+    std::vector<BasicBlock*> succs, preds;
+
+    BasicBlock(int n) : num(n) {}
+
+         // Returns the label that opens this block, or NULL if the block
+         // is only entered by falling through from its predecessor.
+    const char *GetLabel();
+    Instruction *Last() { return code.empty() ? NULL : code.back(); }
+};
+
+
+class FlowGraph {
+  protected:
+    BeginFunc *begin;
+    std::vector<BasicBlock*> blocks;
+
+  public:
+         // Builds the graph for the instructions in [first, last), which
+         // should be everything between a BeginFunc and its EndFunc.
+    FlowGraph(BeginFunc *begin, std::list<Instruction*>::iterator first,
+              std::list<Instruction*>::iterator last);
+
+    int NumBlocks() const           { return blocks.size(); }
+    BasicBlock *Nth(int index)      { return blocks[index]; }
+    BasicBlock *Entry()             { return blocks[0]; }
+    BasicBlock *BlockForLabel(const char *label);
+
+         // Recomputes succs/preds from the block terminators. Passes
+         // that add, remove or retarget branches call this afterwards.
+    void ComputeEdges();
+
+         // Fills order with the blocks reachable from the entry in
+         // reverse postorder, the usual visiting order for forward
+         // dataflow problems (reverse it for backward ones).
+    void ReversePostorder(std::vector<BasicBlock*> *order);
+
+         // Live variable analysis. ComputeLiveOut finds, for each
+         // block, the locations whose value on exit may still be read
+         // by this function; StepLiveness turns the set live after
+         // instr into the set live before it.
+    void ComputeLiveOut(std::vector<LocationSet> *liveOut);
+    static void StepLiveness(Instruction *instr, LocationSet *live);
+
+         // Discards every block whose entry in keep is false and then
+         // recomputes the edges. The entry block is always kept.
+    void RemoveBlocks(const std::vector<bool> &keep);
+
+         // Creates a new temporary in this function's stack frame,
+         // growing the frame size recorded in its BeginFunc.
+    Location *NewTemp();
+
+         // Reserves numBytes at the bottom of this function's stack
+         // frame and returns the fp offset of their lowest address.
+    int ReserveFrameSpace(int numBytes);
+
+         // Appends the instructions of all blocks, in layout order.
+    void Linearize(std::list<Instruction*> *out);
+};
+
+#endif
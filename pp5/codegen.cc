@@ -9,6 +9,7 @@
 #include <string.h>
 #include "tac.h"
 #include "mips.h"
+#include "optimizer.h"
 
 #include <iostream>
 using namespace std;
@@ -17,6 +18,10 @@ Location* CodeGenerator::ThisPtr= new Location(fpRelative, 4, "this");
   
 CodeGenerator::CodeGenerator()
 {
+  localOffset = OffsetToFirstLocal;
+  paramOffset = OffsetToFirstParam;
+  globalOffset = OffsetToFirstGlobal;
+  classOffset = 0;
 }
 
 char *CodeGenerator::NewLabel()
@@ -28,6 +33,11 @@ char *CodeGenerator::NewLabel()
 }
 
 
+bool CodeGenerator::IsTempVar(Location *loc)
+{
+  return loc->GetSegment() == fpRelative && strncmp(loc->GetName(), "_tmp", 4) == 0;
+}
+
 Location *CodeGenerator::GenTempVar()
 {
   // crashes/undefined behavior for programs with over 99,999 temp variables?
@@ -75,16 +85,17 @@ void CodeGenerator::GenAssign(Location *dst, Location *src)
 }
 
 
-Location *CodeGenerator::GenLoad(Location *ref, int offset)
+Location *CodeGenerator::GenLoad(Location *ref, int offset, const char *aliasClass)
 {
   Location *result = GenTempVar();
-  code.push_back(new Load(result, ref, offset));
+  code.push_back(new Load(result, ref, offset, aliasClass));
   return result;
 }
 
-void CodeGenerator::GenStore(Location *dst,Location *src, int offset)
+void CodeGenerator::GenStore(Location *dst,Location *src, int offset,
+                             const char *aliasClass)
 {
-  code.push_back(new Store(dst, src, offset));
+  code.push_back(new Store(dst, src, offset, aliasClass));
 }
 
 
@@ -130,6 +141,11 @@ void CodeGenerator::GenEndFunc()
   code.push_back(new EndFunc());
 }
 
+void CodeGenerator::GenNullCheck(Location *ref)
+{
+  code.push_back(new NullCheck(ref));
+}
+
 void CodeGenerator::GenPushParam(Location *param)
 {
   code.push_back(new PushParam(param));
@@ -189,15 +205,35 @@ Location *CodeGenerator::GenBuiltInCall(BuiltIn bn,Location *arg1, Location *arg
   return result;
 }
 
+BuiltIn CodeGenerator::BuiltInForLabel(const char *label)
+{
+  for (int i = 0; i < NumBuiltIns; i++)
+    if (!strcmp(builtins[i].label, label)) return (BuiltIn)i;
+  return NumBuiltIns;
+}
+
 
-void CodeGenerator::GenVTable(const char *className, List<const char *> *methodLabels)
+VTable *CodeGenerator::GenVTable(const char *className, List<const char *> *methodLabels)
 {
-  code.push_back(new VTable(className, methodLabels));
+  VTable *result = new VTable(className, methodLabels);
+  code.push_back(result);
+  return result;
+}
+
+Location *CodeGenerator::GenLoadSelector(Location *vtable, const char *selector)
+{
+  Location *result = GenTempVar();
+  code.push_back(new LoadSelector(result, vtable, selector));
+  return result;
 }
 
 
 void CodeGenerator::DoFinalCodeGen()
 {
+  if (!IsDebugOn("noopt"))
+    OptimizeCode(&code);
+  AssignSelectorSlots(&code);
+
   if (IsDebugOn("tac")) { // if debug don't translate to mips, just print Tac
     std::list<Instruction*>::iterator p;
     for (p= code.begin(); p != code.end(); ++p) {
@@ -211,6 +247,7 @@ void CodeGenerator::DoFinalCodeGen()
     for (p= code.begin(); p != code.end(); ++p) {
       (*p)->Emit(&mips);
     }
+    mips.EmitPostamble();
   }
 }
 
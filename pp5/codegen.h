@@ -54,6 +54,11 @@ class CodeGenerator {
 
     static Location* ThisPtr;
 
+         // Gives every interface selector its slot in the vtables of
+         // code (dispatch.cc). Needs the whole program, so it runs just
+         // before final code generation.
+    static void AssignSelectorSlots(std::list<Instruction*> *code);
+
          // Assigns a new unique label name and returns it. Does not
          // generate any Tac instructions (see GenLabel below if needed)
     char *NewLabel();
@@ -63,6 +68,11 @@ class CodeGenerator {
          // temp variable. Does not generate any Tac instructions
     Location *GenTempVar();
 
+         // Whether loc is a temp made by GenTempVar rather than a
+         // variable of the program. Decaf names can't begin with an
+         // underscore, so no variable is ever named like a temp.
+    static bool IsTempVar(Location *loc);
+
          // Generates Tac instructions to load a constant value. Creates
          // a new temp var to hold the result. The constant 
          // value is passed as an integer, it can be 0 for integer zero,
@@ -85,7 +95,11 @@ class CodeGenerator {
          // (most likely computed from an array or field offset calculation).
          // The optional offset argument can be used to offset the addr by a
          // positive/negative number of bytes. If not given, 0 is assumed.
-    void GenStore(Location *addr, Location *val, int offset = 0);
+         // The optional aliasClass is the static type of the memory
+         // written (see Load/Store in tac.h); it lets the optimizer know
+         // which other loads and stores cannot touch the same word.
+    void GenStore(Location *addr, Location *val, int offset = 0,
+                  const char *aliasClass = NULL);
 
          // Generates Tac instructions to dereference addr and load contents
          // from a memory location into a new temp var. addr should hold a
@@ -94,7 +108,9 @@ class CodeGenerator {
          // temporary variable where the result was stored. The optional
          // offset argument can be used to offset the addr by a positive or
          // negative number of bytes. If not given, 0 is assumed.
-    Location *GenLoad(Location *addr, int offset = 0);
+         // aliasClass is as described for GenStore above.
+    Location *GenLoad(Location *addr, int offset = 0,
+                      const char *aliasClass = NULL);
 
     
          // Generates Tac instructions to perform one of the binary ops
@@ -104,6 +120,14 @@ class CodeGenerator {
     Location *GenBinaryOp(const char *opName, Location *op1, Location *op2);
 
     
+         // Generates the Tac instruction to check that the object
+         // reference in ref is not null before it is dereferenced (for a
+         // field access or method call). A failed check halts with a
+         // runtime error. The optimizer removes checks on references
+         // already known to be non-null, e.g. "this" or a fresh object.
+    void GenNullCheck(Location *ref);
+
+
          // Generates the Tac instruction for pushing a single
          // parameter. Used to set up for ACall and LCall instructions.
          // The Decaf convention is that parameters are pushed right
@@ -141,6 +165,10 @@ class CodeGenerator {
          // is created and NULL is returned.
     Location *GenBuiltInCall(BuiltIn b, Location *arg1 = NULL, Location *arg2 = NULL);
 
+         // Returns the BuiltIn whose runtime routine has the given
+         // label, or NumBuiltIns if the label is not a built-in.
+    static BuiltIn BuiltInForLabel(const char *label);
+
     
          // These methods generate the Tac instructions for various
          // control flow (branches, jumps, returns, labels)
@@ -164,7 +192,15 @@ class CodeGenerator {
          // methods in the order they should be laid out.  The vtable
          // is tagged with a label of the class name, so when you later
          // need access to the vtable, you use LoadLabel of class name.
-    void GenVTable(const char *className, List<const char*> *methodLabels);
+         // The methods implementing the class's interfaces are then
+         // added to the returned VTable with AddSelector.
+    VTable *GenVTable(const char *className, List<const char*> *methodLabels);
+
+         // Generates the Tac instruction to look up the method for an
+         // interface selector (e.g. "Shape.Area") in the vtable whose
+         // address is in vtable. Returns the Location of the new temp
+         // var holding the method address, ready for GenACall.
+    Location *GenLoadSelector(Location *vtable, const char *selector);
 
 
          // Emits the final "object code" for the program by
@@ -173,6 +209,10 @@ class CodeGenerator {
          // flag tac is on (-d tac), it will not translate to MIPS,
          // but instead just print the untranslated Tac. It may be
          // useful in debugging to first make sure your Tac is correct.
+         // The Tac is run through the optimizer (see optimizer.h) first,
+         // unless the debug flag noopt is on. The MIPS translation ends
+         // with the program's string constants and the run-time
+         // routines it uses (see runtime.h).
     void DoFinalCodeGen();
 };
 
@@ -0,0 +1,274 @@
+/* File: constprop.cc
+ * ------------------
+ * Sparse conditional constant propagation (Wegman & Zadeck) over the
+ * FlowGraph of a function.
+ *
+ * Our Tac is not strictly in SSA form: every temporary is assigned
+ * exactly once by construction, but named variables can be assigned
+ * many times. So instead of one lattice cell per SSA name we keep a
+ * small environment for each block, mapping each location that is
+ * known to be constant on entry to its value. A location missing
+ * from an environment is overdefined; a block that is not yet known to
+ * be executable has no environment at all (undefined). Only edges out
+ * of executable blocks whose branch can actually go that way are
+ * followed, so code behind a constant-false test is never visited and
+ * never pollutes the facts at the join point.
+ *
+ * Globals are only tracked when FindConstantGlobals has shown they
+ * never change from their initial zero, e.g. a "bool debug;" that is
+ * only ever set to false. Any other global may be changed by a call.
+ */
+
+#include "optimizer.h"
+#include "codegen.h"
+#include <string.h>
+#include <utility>
+
+typedef std::map<Location*, int, LocationLess> ConstEnv;
+typedef std::set<std::pair<int,int> > EdgeSet;
+
+
+/* Function: FoldBinaryOp
+ * ----------------------
+ * Computes op1 <code> op2 the way the MIPS instruction for it would
+ * (32-bit wraparound, truncating division, seq/slt giving 0 or 1).
+ * Returns false for divisions we must leave to run time.
+ */
+static bool FoldBinaryOp(BinaryOp::OpCode code, int a, int b, int *result)
+{
+  unsigned ua = a, ub = b;
+  switch (code) {
+    case BinaryOp::Add:  *result = (int)(ua + ub); return true;
+    case BinaryOp::Sub:  *result = (int)(ua - ub); return true;
+    case BinaryOp::Mul:  *result = (int)(ua * ub); return true;
+    case BinaryOp::Div:
+    case BinaryOp::Mod:
+      if (b == 0 || (b == -1 && a == (int)0x80000000)) return false;
+      *result = (code == BinaryOp::Div) ? a / b : a % b;
+      return true;
+    case BinaryOp::Eq:   *result = (a == b); return true;
+    case BinaryOp::Less: *result = (a < b); return true;
+    case BinaryOp::And:  *result = a & b; return true;
+    case BinaryOp::Or:   *result = a | b; return true;
+    default: return false;
+  }
+}
+
+
+static bool IsTracked(Location *loc, const LocationSet &constantGlobals)
+{
+  return loc->GetSegment() == fpRelative || constantGlobals.count(loc);
+}
+
+
+/* Function: ValueOf
+ * -----------------
+ * Returns whether instr leaves a known constant in its destination,
+ * given the facts in env just before it, and stores that constant.
+ */
+static bool ValueOf(Instruction *instr, ConstEnv &env, int *value)
+{
+  if (LoadConstant *lc = dynamic_cast<LoadConstant*>(instr)) {
+    *value = lc->GetValue();
+    return true;
+  }
+  if (Assign *a = dynamic_cast<Assign*>(instr)) {
+    ConstEnv::iterator src = env.find(a->GetSrc());
+    if (src == env.end()) return false;
+    *value = src->second;
+    return true;
+  }
+  if (BinaryOp *op = dynamic_cast<BinaryOp*>(instr)) {
+    ConstEnv::iterator op1 = env.find(op->GetOp1()), op2 = env.find(op->GetOp2());
+    return op1 != env.end() && op2 != env.end()
+        && FoldBinaryOp(op->GetOpCode(), op1->second, op2->second, value);
+  }
+  return false;
+}
+
+
+static void Transfer(Instruction *instr, ConstEnv &env, const LocationSet &constantGlobals)
+{
+  Location *dst = instr->GetDst();
+  int value;
+  if (!dst) return;
+  if (IsTracked(dst, constantGlobals) && ValueOf(instr, env, &value))
+    env[dst] = value;
+  else
+    env.erase(dst);
+}
+
+
+/* Function: Meet
+ * --------------
+ * Intersects env with other: a location stays constant only if both
+ * agree on its value.
+ */
+static void Meet(ConstEnv &env, ConstEnv &other)
+{
+  ConstEnv::iterator p = env.begin();
+  while (p != env.end()) {
+    ConstEnv::iterator q = other.find(p->first);
+    if (q == other.end() || q->second != p->second) env.erase(p++);
+    else ++p;
+  }
+}
+
+
+/* Function: EntryFacts
+ * ---------------------
+ * Meets the exit facts of all executable in-edges of b. The entry
+ * block also sees the facts that hold when the function is called.
+ */
+static ConstEnv EntryFacts(BasicBlock *b, std::vector<ConstEnv> &out,
+                           EdgeSet &edges, ConstEnv &initial)
+{
+  ConstEnv env;
+  bool first = true;
+  if (b->num == 0) { env = initial; first = false; }
+  for (int i = 0; i < b->preds.size(); i++) {
+    if (!edges.count(std::make_pair(b->preds[i]->num, b->num))) continue;
+    if (first) env = out[b->preds[i]->num];
+    else Meet(env, out[b->preds[i]->num]);
+    first = false;
+  }
+  return env;
+}
+
+
+/* Function: FindConstantGlobals
+ * -----------------------------
+ * A global qualifies if every write to it anywhere in the program
+ * stores zero, either directly or by copying a temporary whose only
+ * definition in that function loads zero. Only temps made by the code
+ * generator will do: a formal or local with a single zero store in the
+ * body can still hold the value it came in with.
+ */
+void FindConstantGlobals(std::list<Instruction*> *code, LocationSet *globals)
+{
+  LocationSet written;
+  std::map<Location*, int, LocationLess> defs, zeroDefs;
+  std::list<Instruction*>::iterator p, fn = code->begin();
+
+  for (p = code->begin(); p != code->end(); ++p) {
+    if (dynamic_cast<BeginFunc*>(*p)) {      // facts about temps are per-function
+      defs.clear(); zeroDefs.clear();
+      for (fn = p; fn != code->end() && !dynamic_cast<EndFunc*>(*fn); ++fn) {
+        Location *dst = (*fn)->GetDst();
+        if (!dst) continue;
+        defs[dst]++;
+        LoadConstant *lc = dynamic_cast<LoadConstant*>(*fn);
+        if (lc && lc->GetValue() == 0) zeroDefs[dst]++;
+      }
+    }
+    Location *srcs[Instruction::MaxSrcs];
+    int n = (*p)->GetSrcs(srcs);
+    for (int i = 0; i < n; i++)
+      if (srcs[i]->GetSegment() == gpRelative) globals->insert(srcs[i]);
+
+    Location *dst = (*p)->GetDst();
+    if (!dst || dst->GetSegment() != gpRelative) continue;
+    globals->insert(dst);
+    LoadConstant *lc = dynamic_cast<LoadConstant*>(*p);
+    Assign *a = dynamic_cast<Assign*>(*p);
+    bool storesZero = (lc && lc->GetValue() == 0)
+        || (a && CodeGenerator::IsTempVar(a->GetSrc())
+            && defs[a->GetSrc()] == 1 && zeroDefs[a->GetSrc()] == 1);
+    if (!storesZero) written.insert(dst);
+  }
+  for (LocationSet::iterator g = written.begin(); g != written.end(); ++g)
+    globals->erase(*g);
+}
+
+
+/* Function: PropagateConstants
+ * ----------------------------
+ * The analysis iterates a worklist of blocks. Whenever a block is
+ * (re)visited, its entry environment is the meet of the exit
+ * environments of its executable in-edges; the block is then
+ * simulated and the out-edges its terminator can take are marked
+ * executable. A successor is revisited when one of its in-edges first
+ * becomes executable or the facts flowing along one change. Since
+ * facts only ever get dropped, this reaches a fixed point.
+ *
+ * Afterwards each executable block is simulated once more to rewrite
+ * it: computations with a known result become LoadConstant, IfZ on a
+ * known test becomes a Goto or disappears, and blocks never found
+ * executable are deleted along with branches to the very next block.
+ */
+void PropagateConstants(FlowGraph *graph, const LocationSet &constantGlobals)
+{
+  int n = graph->NumBlocks();
+  std::vector<bool> executable(n, false);
+  std::vector<ConstEnv> out(n);
+  EdgeSet edges;
+  std::vector<int> worklist;
+  ConstEnv initial;
+  for (LocationSet::const_iterator g = constantGlobals.begin(); g != constantGlobals.end(); ++g)
+    initial[*g] = 0;
+
+  worklist.push_back(0);
+  while (!worklist.empty()) {
+    BasicBlock *b = graph->Nth(worklist.back());
+    worklist.pop_back();
+
+    ConstEnv env = EntryFacts(b, out, edges, initial);
+    for (int i = 0; i < b->code.size(); i++)
+      Transfer(b->code[i], env, constantGlobals);
+
+    bool changed = !executable[b->num] || env != out[b->num];
+    executable[b->num] = true;
+    out[b->num] = env;
+
+    IfZ *ifz = dynamic_cast<IfZ*>(b->Last());
+    ConstEnv::iterator test = ifz ? env.find(ifz->GetTest()) : env.end();
+    for (int i = 0; i < b->succs.size(); i++) {
+      BasicBlock *s = b->succs[i];
+      if (test != env.end()) {         // only one way out of a known test
+        bool isTarget = (s == graph->BlockForLabel(ifz->branch_label()));
+        bool isNext = (b->num + 1 < n && s == graph->Nth(b->num + 1));
+        if (!(test->second == 0 ? isTarget : isNext)) continue;
+      }
+      bool newEdge = edges.insert(std::make_pair(b->num, s->num)).second;
+      if (newEdge || changed) worklist.push_back(s->num);
+    }
+  }
+
+  for (int k = 0; k < n; k++) {
+    BasicBlock *b = graph->Nth(k);
+    if (!executable[k]) continue;
+    ConstEnv env = EntryFacts(b, out, edges, initial);
+    std::vector<Instruction*> code;
+    for (int i = 0; i < b->code.size(); i++) {
+      Instruction *instr = b->code[i];
+      int value;
+      if (IfZ *ifz = dynamic_cast<IfZ*>(instr)) {
+        ConstEnv::iterator test = env.find(ifz->GetTest());
+        if (test != env.end()) {
+          if (test->second == 0) code.push_back(new Goto(ifz->branch_label()));
+          continue;
+        }
+      } else if ((dynamic_cast<Assign*>(instr) || dynamic_cast<BinaryOp*>(instr))
+                 && IsTracked(instr->GetDst(), constantGlobals)
+                 && ValueOf(instr, env, &value)) {
+        Location *dst = instr->GetDst();
+        Transfer(instr, env, constantGlobals);
+        code.push_back(new LoadConstant(dst, value));
+        continue;
+      }
+      Transfer(instr, env, constantGlobals);
+      code.push_back(instr);
+    }
+    b->code = code;
+  }
+  graph->RemoveBlocks(executable);
+
+  for (int k = 0; k + 1 < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    Goto *g = dynamic_cast<Goto*>(b->Last());
+    const char *next = graph->Nth(k+1)->GetLabel();
+    if (g && next && !strcmp(g->branch_label(), next))
+      b->code.pop_back();
+  }
+  graph->ComputeEdges();
+}
@@ -0,0 +1,74 @@
+/* File: dispatch.cc
+ * -----------------
+ * Slot assignment for interface method dispatch.
+ *
+ * A class method has the same vtable slot in a class and all of its
+ * subclasses, but a class can implement any number of interfaces, so
+ * an interface method cannot simply take the next slot. Instead each
+ * interface selector gets a slot of its own, program-wide, laid out
+ * before the class methods in every vtable that provides it. Two
+ * selectors can share a slot as long as no class provides both: this
+ * is graph coloring, with an edge between selectors found together in
+ * some vtable. We color greedily, most constrained selector first,
+ * which keeps the tables short; vtables only extend as far back as the
+ * highest slot they use.
+ */
+
+#include "codegen.h"
+#include <map>
+#include <set>
+#include <string>
+#include <algorithm>
+
+using std::string;
+
+
+/* Method: AssignSelectorSlots
+ * ---------------------------
+ * Builds the conflict graph from the selectors of each VTable in code,
+ * colors it and hands the slots out to the VTables and LoadSelectors.
+ */
+void CodeGenerator::AssignSelectorSlots(std::list<Instruction*> *code)
+{
+  std::map<string, std::set<string> > conflicts;
+  std::list<Instruction*>::iterator p;
+  for (p = code->begin(); p != code->end(); ++p) {
+    VTable *vt = dynamic_cast<VTable*>(*p);
+    if (!vt) continue;
+    List<const char *> *selectors = vt->GetSelectors();
+    for (int i = 0; i < selectors->NumElements(); i++) {
+      std::set<string> &others = conflicts[selectors->Nth(i)];
+      for (int j = 0; j < selectors->NumElements(); j++)
+        if (j != i) others.insert(selectors->Nth(j));
+    }
+  }
+
+  std::vector<std::pair<int, string> > order;
+  std::map<string, std::set<string> >::iterator s;
+  for (s = conflicts.begin(); s != conflicts.end(); ++s)
+    order.push_back(std::make_pair(-(int)s->second.size(), s->first));
+  std::sort(order.begin(), order.end());
+
+  std::map<string, int> slots;
+  for (int i = 0; i < order.size(); i++) {
+    std::set<int> taken;
+    std::set<string> &others = conflicts[order[i].second];
+    for (std::set<string>::iterator o = others.begin(); o != others.end(); ++o)
+      if (slots.count(*o)) taken.insert(slots[*o]);
+    int slot = 0;
+    while (taken.count(slot)) slot++;
+    slots[order[i].second] = slot;
+  }
+
+  for (p = code->begin(); p != code->end(); ++p) {
+    if (VTable *vt = dynamic_cast<VTable*>(*p)) {
+      List<const char *> *selectors = vt->GetSelectors();
+      for (int i = 0; i < selectors->NumElements(); i++)
+        vt->SetSlot(i, slots[selectors->Nth(i)]);
+    } else if (LoadSelector *ls = dynamic_cast<LoadSelector*>(*p)) {
+      // If no vtable provides the selector, no object implementing the
+      // interface is ever created, and the lookup is never reached.
+      ls->SetSlot(slots.count(ls->GetSelector()) ? slots[ls->GetSelector()] : 0);
+    }
+  }
+}
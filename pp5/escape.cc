@@ -0,0 +1,298 @@
+/* File: escape.cc
+ * ---------------
+ * Escape analysis, and the two ways we exploit it: scalar replacement
+ * of objects that do not escape, and failing that, stack allocation.
+ *
+ * An object is created by the sequence the front end generates for
+ * New or NewArray:
+ *      PushParam size
+ *      t = LCall _Alloc
+ *      PopParams 4
+ * Its aliases are t, every location a copy of an alias is assigned to,
+ * and every address computed from an alias by arithmetic (array
+ * element addresses, for instance). The object escapes the function
+ * if any alias is
+ *   - stored into memory (as a value, not as the base of the Store),
+ *   - pushed as a parameter, which covers passing it as "this",
+ *   - returned, or
+ *   - assigned to a global,
+ * or used by any instruction we don't know how to reason about.
+ * Loads and Stores through an alias, comparisons and branches on it
+ * are harmless.
+ */
+
+#include "optimizer.h"
+#include "codegen.h"
+#include <algorithm>
+
+    // Larger objects are left in the heap, to keep frames small
+static const int MaxStackObjectBytes = 128;
+
+
+static bool SameLocation(Location *a, Location *b)
+{
+  LocationLess less;
+  return !less(a, b) && !less(b, a);
+}
+
+
+/* Function: UseIsHarmless
+ * -----------------------
+ * Whether instr reading the alias loc neither lets the object escape
+ * nor copies it somewhere we fail to track.
+ */
+static bool UseIsHarmless(Instruction *instr, Location *loc)
+{
+  if (Store *st = dynamic_cast<Store*>(instr))
+    return !SameLocation(st->GetValue(), loc);
+  if (Assign *a = dynamic_cast<Assign*>(instr))
+    return a->GetDst()->GetSegment() != gpRelative;
+  return dynamic_cast<Load*>(instr) || dynamic_cast<BinaryOp*>(instr)
+      || dynamic_cast<IfZ*>(instr) || dynamic_cast<NullCheck*>(instr);
+}
+
+
+/* Function: ObjectEscapes
+ * -----------------------
+ * Grows aliases from object to a fixed point, then checks every use
+ * of every alias. Comparisons and logical operations yield a boolean,
+ * not a pointer, so their results are not aliases.
+ */
+bool ObjectEscapes(FlowGraph *graph, Location *object, LocationSet *aliases)
+{
+  aliases->clear();
+  aliases->insert(object);
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = 0; k < graph->NumBlocks(); k++) {
+      BasicBlock *b = graph->Nth(k);
+      for (int i = 0; i < b->code.size(); i++) {
+        Location *derived = NULL;
+        if (Assign *a = dynamic_cast<Assign*>(b->code[i])) {
+          if (aliases->count(a->GetSrc())) derived = a->GetDst();
+        } else if (BinaryOp *op = dynamic_cast<BinaryOp*>(b->code[i])) {
+          if (op->GetOpCode() != BinaryOp::Eq && op->GetOpCode() != BinaryOp::Less
+              && op->GetOpCode() != BinaryOp::And && op->GetOpCode() != BinaryOp::Or
+              && (aliases->count(op->GetOp1()) || aliases->count(op->GetOp2())))
+            derived = op->GetDst();
+        }
+        if (derived && aliases->insert(derived).second) changed = true;
+      }
+    }
+  }
+
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    for (int i = 0; i < b->code.size(); i++) {
+      Location *srcs[Instruction::MaxSrcs];
+      int n = b->code[i]->GetSrcs(srcs);
+      for (int j = 0; j < n; j++)
+        if (aliases->count(srcs[j]) && !UseIsHarmless(b->code[i], srcs[j]))
+          return true;
+    }
+  }
+  return false;
+}
+
+
+/* Function: IsAllocSequence
+ * -------------------------
+ * Whether the instructions of b starting at index are the three that
+ * allocate an object, as shown at the top of the file.
+ */
+static bool IsAllocSequence(BasicBlock *b, int index)
+{
+  if (index + 2 >= b->code.size()) return false;
+  LCall *lc = dynamic_cast<LCall*>(b->code[index + 1]);
+  PopParams *pp = dynamic_cast<PopParams*>(b->code[index + 2]);
+  return dynamic_cast<PushParam*>(b->code[index]) && lc && pp
+      && lc->GetDst() && pp->GetNumBytes() == CodeGenerator::VarSize
+      && CodeGenerator::BuiltInForLabel(lc->GetLabel()) == Alloc;
+}
+
+
+/* Function: FindConstantSizes
+ * ---------------------------
+ * Records in sizes the locations of the function that are assigned
+ * exactly once, by a LoadConstant. The size pushed for _Alloc is
+ * always such a temporary when it is known at compile time.
+ */
+void FindConstantSizes(FlowGraph *graph, std::map<Location*,int,LocationLess> *sizes)
+{
+  std::map<Location*,int,LocationLess> numDefs;
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    for (int i = 0; i < b->code.size(); i++) {
+      Location *dst = b->code[i]->GetDst();
+      if (!dst) continue;
+      numDefs[dst]++;
+      if (LoadConstant *lc = dynamic_cast<LoadConstant*>(b->code[i]))
+        (*sizes)[dst] = lc->GetValue();
+    }
+  }
+  std::map<Location*,int,LocationLess>::iterator p = sizes->begin();
+  while (p != sizes->end()) {
+    if (numDefs[p->first] != 1) sizes->erase(p++);
+    else ++p;
+  }
+}
+
+
+/* Function: AnyLiveBefore
+ * -----------------------
+ * Whether any of locs is live right before instruction index of b,
+ * given what is live on exit from b.
+ */
+static bool AnyLiveBefore(BasicBlock *b, int index, const LocationSet &liveOut,
+                          const LocationSet &locs)
+{
+  LocationSet live = liveOut;
+  for (int j = b->code.size() - 1; j >= index; j--)
+    FlowGraph::StepLiveness(b->code[j], &live);
+  for (LocationSet::iterator p = locs.begin(); p != locs.end(); ++p)
+    if (live.count(*p)) return true;
+  return false;
+}
+
+
+/* Function: AllocateOnStack
+ * -------------------------
+ * Replaces each allocation of a small, constant-size object that does
+ * not escape with a StackAlloc in the function's own frame. The frame
+ * slot is reused each time the allocation executes, so in a loop the
+ * object made on the previous trip must be dead by then: we insist
+ * that no alias is live right before the allocation. Outside of loops
+ * this holds trivially.
+ */
+void AllocateOnStack(FlowGraph *graph)
+{
+  std::map<Location*,int,LocationLess> sizes;
+  std::vector<LocationSet> liveOut;
+  FindConstantSizes(graph, &sizes);
+  graph->ComputeLiveOut(&liveOut);
+
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    for (int i = 0; i < b->code.size(); i++) {
+      if (!IsAllocSequence(b, i)) continue;
+      Location *size = dynamic_cast<PushParam*>(b->code[i])->GetParam();
+      Location *object = b->code[i + 1]->GetDst();
+      if (!sizes.count(size)) continue;
+      int numBytes = sizes[size];
+      if (numBytes <= 0 || numBytes > MaxStackObjectBytes
+          || numBytes % CodeGenerator::VarSize != 0)
+        continue;
+
+      LocationSet aliases;
+      if (ObjectEscapes(graph, object, &aliases)
+          || AnyLiveBefore(b, i, liveOut[k], aliases))
+        continue;
+
+      int offset = graph->ReserveFrameSpace(numBytes);
+      b->code[i] = new StackAlloc(object, offset, numBytes);
+      b->code.erase(b->code.begin() + i + 1, b->code.begin() + i + 3);
+    }
+  }
+}
+
+
+/* Function: CanReplaceWithScalars
+ * -------------------------------
+ * An object can be broken up into scalars if, besides not escaping,
+ * it is only ever reached through copies of the pointer _Alloc
+ * returned (no computed addresses), each alias holds nothing but that
+ * pointer, and the aliases are used only as the base of a Load or
+ * Store, to be copied to another alias, or to be null checked.
+ */
+static bool CanReplaceWithScalars(FlowGraph *graph, Instruction *alloc,
+                                  const LocationSet &aliases)
+{
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    for (int i = 0; i < b->code.size(); i++) {
+      Instruction *instr = b->code[i];
+      Assign *a = dynamic_cast<Assign*>(instr);
+      Location *dst = instr->GetDst();
+      if (dst && aliases.count(dst) && instr != alloc
+          && !(a && aliases.count(a->GetSrc())))
+        return false;
+
+      Location *srcs[Instruction::MaxSrcs];
+      int n = instr->GetSrcs(srcs);
+      for (int j = 0; j < n; j++) {
+        if (!aliases.count(srcs[j])) continue;
+        Load *ld = dynamic_cast<Load*>(instr);
+        Store *st = dynamic_cast<Store*>(instr);
+        if (!(ld || st || a || dynamic_cast<NullCheck*>(instr)))
+          return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+/* Function: ReplaceObjectsWithScalars
+ * -----------------------------------
+ * Scalar replacement: each field of a suitable object becomes a new
+ * temporary of the function. The allocation turns into clearing
+ * those temporaries, a Load or Store of a field into a copy from or
+ * to its temporary, and the copies and null checks of the pointer
+ * itself go away. As with AllocateOnStack, the temporaries are reused
+ * each time the allocation executes, so no alias may be live there.
+ */
+void ReplaceObjectsWithScalars(FlowGraph *graph)
+{
+  std::vector<LocationSet> liveOut;
+  graph->ComputeLiveOut(&liveOut);
+
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    for (int i = 0; i < b->code.size(); i++) {
+      if (!IsAllocSequence(b, i)) continue;
+      Location *object = b->code[i + 1]->GetDst();
+      LocationSet aliases;
+      if (ObjectEscapes(graph, object, &aliases)
+          || !CanReplaceWithScalars(graph, b->code[i + 1], aliases)
+          || AnyLiveBefore(b, i, liveOut[k], aliases))
+        continue;
+
+      Instruction *call = b->code[i + 1];
+      std::map<int, Location*> fields;
+      for (int m = 0; m < graph->NumBlocks(); m++) {
+        BasicBlock *other = graph->Nth(m);
+        std::vector<Instruction*> code;
+        for (int j = 0; j < other->code.size(); j++) {
+          Instruction *instr = other->code[j];
+          Load *ld = dynamic_cast<Load*>(instr);
+          Store *st = dynamic_cast<Store*>(instr);
+          Assign *a = dynamic_cast<Assign*>(instr);
+          NullCheck *nc = dynamic_cast<NullCheck*>(instr);
+          if (ld && aliases.count(ld->GetReference())) {
+            if (!fields[ld->GetOffset()]) fields[ld->GetOffset()] = graph->NewTemp();
+            instr = new Assign(ld->GetDst(), fields[ld->GetOffset()]);
+          } else if (st && aliases.count(st->GetReference())) {
+            if (!fields[st->GetOffset()]) fields[st->GetOffset()] = graph->NewTemp();
+            instr = new Assign(fields[st->GetOffset()], st->GetValue());
+          } else if ((a && aliases.count(a->GetDst()))
+                     || (nc && aliases.count(nc->GetReference()))) {
+            continue;
+          }
+          code.push_back(instr);
+        }
+        other->code = code;
+      }
+
+      // Dropping copies and null checks earlier in b moves the allocation
+      i = std::find(b->code.begin(), b->code.end(), call) - b->code.begin() - 1;
+      std::vector<Instruction*> clear;
+      for (std::map<int, Location*>::iterator p = fields.begin(); p != fields.end(); ++p)
+        clear.push_back(new LoadConstant(p->second, 0));
+      b->code.erase(b->code.begin() + i, b->code.begin() + i + 3);
+      b->code.insert(b->code.begin() + i, clear.begin(), clear.end());
+      i += (int)clear.size() - 1;   // -1 if the object had no fields
+      graph->ComputeLiveOut(&liveOut);
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/* File: fastcall.cc
+ * -----------------
+ * Cheaper calls to the built-ins that have a register-based entry
+ * point in the run-time library. The front end calls a built-in like
+ * any other function:
+ *      PushParam arg
+ *      dst = LCall _Alloc
+ *      PopParams 4
+ * and the routine then sets up a frame only to load its argument back
+ * off the stack. Here the whole sequence becomes a single FastCall
+ * that passes the argument in $a0 to the routine's internal entry,
+ * with no parameter pushed or popped. Better still, an allocation
+ * whose size is a constant becomes an InlineAlloc, which usually
+ * doesn't call at all. A call to _Halt becomes a FastCall to
+ * __FlushOutput, so that buffered output is written out, followed by
+ * the exit syscall.
+ *
+ * The print built-ins stay ordinary calls: they append to the output
+ * buffer in the run-time library rather than make a syscall of their
+ * own, and have no internal entry.
+ */
+
+#include "optimizer.h"
+#include "codegen.h"
+
+
+static struct _expansion {
+  BuiltIn builtIn;
+  const char *entry;
+  bool hasArg;
+  int syscall;      // made after the call, 0 for none
+} expansions[] =
+ {{Alloc, "__Malloc", true, 0},
+  {Halt, "__FlushOutput", false, 10}};
+
+static const int NumExpansions = sizeof(expansions) / sizeof(expansions[0]);
+
+
+/* Function: ExpansionForCall
+ * --------------------------
+ * Returns the expansion that applies to instr, or NULL if instr is
+ * not a call to one of the built-ins above.
+ */
+static struct _expansion *ExpansionForCall(Instruction *instr)
+{
+  LCall *lc = dynamic_cast<LCall*>(instr);
+  if (!lc) return NULL;
+  BuiltIn b = CodeGenerator::BuiltInForLabel(lc->GetLabel());
+  for (int i = 0; i < NumExpansions; i++)
+    if (expansions[i].builtIn == b) return &expansions[i];
+  return NULL;
+}
+
+
+/* Function: ExpandBuiltIns
+ * ------------------------
+ * A built-in taking an argument is only expanded when its PushParam
+ * and PopParams sit right next to the call, which is how
+ * GenBuiltInCall lays them out.
+ */
+void ExpandBuiltIns(FlowGraph *graph)
+{
+  std::map<Location*,int,LocationLess> sizes;
+  FindConstantSizes(graph, &sizes);
+  for (int k = 0; k < graph->NumBlocks(); k++) {
+    BasicBlock *b = graph->Nth(k);
+    std::vector<Instruction*> code;
+    for (int i = 0; i < b->code.size(); i++) {
+      struct _expansion *e = ExpansionForCall(b->code[i]);
+      Location *dst = b->code[i]->GetDst();
+      if (e && !e->hasArg) {
+        code.push_back(new FastCall(e->entry, dst, NULL, e->syscall));
+        continue;
+      }
+      PushParam *push = i > 0 ? dynamic_cast<PushParam*>(b->code[i - 1]) : NULL;
+      PopParams *pop = i + 1 < b->code.size() ? dynamic_cast<PopParams*>(b->code[i + 1]) : NULL;
+      if (e && push && pop && pop->GetNumBytes() == CodeGenerator::VarSize) {
+        Location *arg = push->GetParam();
+        if (e->builtIn == Alloc && dst && sizes.count(arg) && sizes[arg] > 0)
+          code.back() = new InlineAlloc(dst, (sizes[arg] + 3) & ~3);
+        else
+          code.back() = new FastCall(e->entry, dst, arg);
+        i++;                     // skip the PopParams
+        continue;
+      }
+      code.push_back(b->code[i]);
+    }
+    b->code = code;
+  }
+}
@@ -0,0 +1,306 @@
+/* File: flatast.cc
+ * ----------------
+ * Building and printing the flat tree, and the Flatten methods of the
+ * node classes that do the building. Each Flatten adds its own node
+ * first, so a parent's index is lower than its children's, then
+ * flattens the children and hands them to SetChildren in one go, which
+ * keeps every node's children contiguous.
+ */
+
+#include "flatast.h"
+#include "ast.h"
+#include "ast_decl.h"
+#include "ast_expr.h"
+#include "ast_stmt.h"
+#include "ast_type.h"
+#include <iostream>
+using namespace std;
+
+
+#define FLAT_KIND_NAME(name) #name,
+const char * const FlatAst::kindName[NumFlatKinds] = { FLAT_NODE_KINDS(FLAT_KIND_NAME) };
+#undef FLAT_KIND_NAME
+
+
+FlatAst::FlatAst(Program *program)
+{
+  root = Flatten(program);
+  for (int i = 0; i < bindings.size(); i++) {
+    std::map<Decl*, NodeRef>::iterator p = declared.find(bindings[i].second);
+    if (p != declared.end()) Get(bindings[i].first).decl = p->second;
+  }
+  bindings.clear();
+  declared.clear();
+}
+
+
+NodeRef FlatAst::Add(FlatKind kind, yyltype *loc)
+{
+  static const yyltype noLocation = {0, 0, 0, 0, 0, NULL};
+  FlatNode n;
+  n.firstChild = n.numChildren = 0;
+  n.name = -1;
+  n.decl = NoNode;
+  n.type = NULL;
+  n.doubleValue = 0;
+  Assert(nodes[kind].size() < (1 << 24));
+  nodes[kind].push_back(n);
+  locations[kind].push_back(loc ? *loc : noLocation);
+  return (kind << 24) | (nodes[kind].size() - 1);
+}
+
+
+void FlatAst::SetChildren(NodeRef r, const std::vector<NodeRef> &kids)
+{
+  FlatNode &n = Get(r);
+  n.firstChild = children.size();
+  n.numChildren = kids.size();
+  children.insert(children.end(), kids.begin(), kids.end());
+}
+
+
+NodeRef FlatAst::Flatten(Node *n)
+{
+  return n ? n->Flatten(this) : NoNode;
+}
+
+
+template <class Elem>
+static void FlattenAll(FlatAst *ast, List<Elem*> *list, std::vector<NodeRef> &kids)
+{
+  for (int i = 0; i < list->NumElements(); i++)
+    kids.push_back(ast->Flatten(list->Nth(i)));
+}
+
+
+/* Class: FlatPrinter
+ * ------------------
+ * Prints each node on its own line under its parent, as
+ * kind name value : type (line). Only the parts the node has appear.
+ */
+class FlatPrinter : public FlatVisitor<FlatPrinter> {
+    int depth;
+
+  public:
+    FlatPrinter(FlatAst *ast) : FlatVisitor<FlatPrinter>(ast), depth(0) {}
+
+    void VisitNode(NodeRef r) {
+      FlatNode &n = ast->Get(r);
+      FlatKind kind = FlatAst::KindOf(r);
+      cout << string(2 * depth, ' ') << FlatAst::kindName[kind];
+      if (n.name != -1) cout << " " << SymbolTable::Name(n.name);
+      switch (kind) {
+        case kIntConstant:    cout << " " << n.intValue; break;
+        case kBoolConstant:   cout << (n.intValue ? " true" : " false"); break;
+        case kDoubleConstant: cout << " " << n.doubleValue; break;
+        case kStringConstant: cout << " " << n.stringValue; break;
+        default: break;
+      }
+      if (n.type) cout << " : " << n.type;
+      if (ast->GetLocation(r).first_line)
+        cout << " (line " << ast->GetLocation(r).first_line << ")";
+      cout << endl;
+      depth++;
+      VisitChildren(r);
+      depth--;
+    }
+};
+
+void FlatAst::Print()
+{
+  FlatPrinter(this).Visit(root);
+}
+
+
+NodeRef Program::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kProgram, location);
+    std::vector<NodeRef> kids;
+    FlattenAll(ast, decls, kids);
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef VarDecl::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kVarDecl, location);
+    ast->Declare(this, r);
+    ast->Get(r).name = GetSymbol();
+    ast->Get(r).type = type;
+    return r;
+}
+
+NodeRef FnDecl::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kFnDecl, location);
+    ast->Declare(this, r);
+    std::vector<NodeRef> kids;
+    FlattenAll(ast, formals, kids);
+    kids.push_back(ast->Flatten(body));
+    ast->SetChildren(r, kids);
+    FlatNode &n = ast->Get(r);
+    n.name = GetSymbol();
+    n.type = returnType;
+    n.intValue = formals->NumElements();
+    return r;
+}
+
+NodeRef ClassDecl::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kClassDecl, location);
+    ast->Declare(this, r);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(extends));
+    FlattenAll(ast, implements, kids);
+    FlattenAll(ast, members, kids);
+    ast->SetChildren(r, kids);
+    ast->Get(r).name = GetSymbol();
+    ast->Get(r).intValue = implements->NumElements();
+    return r;
+}
+
+NodeRef InterfaceDecl::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kInterfaceDecl, location);
+    ast->Declare(this, r);
+    std::vector<NodeRef> kids;
+    FlattenAll(ast, members, kids);
+    ast->SetChildren(r, kids);
+    ast->Get(r).name = GetSymbol();
+    return r;
+}
+
+NodeRef NamedType::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kNamedType, location);
+    ast->Get(r).name = id->GetSymbol();
+    ast->Get(r).type = this;
+    ast->Bind(r, decl);
+    return r;
+}
+
+
+NodeRef StmtBlock::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kStmtBlock, location);
+    std::vector<NodeRef> kids;
+    FlattenAll(ast, decls, kids);
+    FlattenAll(ast, stmts, kids);
+    ast->SetChildren(r, kids);
+    ast->Get(r).intValue = decls->NumElements();
+    return r;
+}
+
+NodeRef IfStmt::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kIfStmt, location);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(test));
+    kids.push_back(ast->Flatten(body));
+    kids.push_back(ast->Flatten(elseBody));
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef WhileStmt::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kWhileStmt, location);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(test));
+    kids.push_back(ast->Flatten(body));
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef ForStmt::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kForStmt, location);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(init));
+    kids.push_back(ast->Flatten(test));
+    kids.push_back(ast->Flatten(step));
+    kids.push_back(ast->Flatten(body));
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef ReturnStmt::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kReturnStmt, location);
+    std::vector<NodeRef> kids(1, ast->Flatten(expr));
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef PrintStmt::Flatten(FlatAst *ast) {
+    NodeRef r = ast->Add(kPrintStmt, location);
+    std::vector<NodeRef> kids;
+    FlattenAll(ast, args, kids);
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+
+NodeRef Expr::AddTo(FlatAst *ast, FlatKind kind) {
+    NodeRef r = ast->Add(kind, location);
+    ast->Get(r).type = type;
+    return r;
+}
+
+NodeRef IntConstant::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kIntConstant);
+    ast->Get(r).intValue = value;
+    return r;
+}
+
+NodeRef DoubleConstant::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kDoubleConstant);
+    ast->Get(r).doubleValue = value;
+    return r;
+}
+
+NodeRef BoolConstant::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kBoolConstant);
+    ast->Get(r).intValue = value;
+    return r;
+}
+
+NodeRef StringConstant::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kStringConstant);
+    ast->Get(r).stringValue = value;
+    return r;
+}
+
+NodeRef CompoundExpr::FlattenAs(FlatAst *ast, FlatKind kind) {
+    NodeRef r = AddTo(ast, kind);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(left));
+    kids.push_back(ast->Flatten(right));
+    ast->SetChildren(r, kids);
+    ast->Get(r).name = SymbolTable::Intern(op->GetOperatorString());
+    return r;
+}
+
+NodeRef ArrayAccess::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kArrayAccess);
+    std::vector<NodeRef> kids;
+    kids.push_back(ast->Flatten(base));
+    kids.push_back(ast->Flatten(subscript));
+    ast->SetChildren(r, kids);
+    return r;
+}
+
+NodeRef FieldAccess::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kFieldAccess);
+    std::vector<NodeRef> kids(1, ast->Flatten(base));
+    ast->SetChildren(r, kids);
+    ast->Get(r).name = field->GetSymbol();
+    ast->Bind(r, decl);
+    return r;
+}
+
+NodeRef Call::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kCall);
+    std::vector<NodeRef> kids(1, ast->Flatten(base));
+    FlattenAll(ast, actuals, kids);
+    ast->SetChildren(r, kids);
+    ast->Get(r).name = field->GetSymbol();
+    ast->Bind(r, decl);
+    return r;
+}
+
+NodeRef NewArrayExpr::Flatten(FlatAst *ast) {
+    NodeRef r = AddTo(ast, kNewArrayExpr);
+    std::vector<NodeRef> kids(1, ast->Flatten(size));
+    ast->SetChildren(r, kids);
+    return r;
+}
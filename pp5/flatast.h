@@ -0,0 +1,190 @@
+/* File: flatast.h
+ * ---------------
+ * A flat copy of the parse tree, for passes that want to sweep over a
+ * large program quickly rather than chase pointers from node to node.
+ *
+ * The nodes of each kind sit together in one array of FlatNodes, all
+ * the same size, and a node is named by a 32-bit NodeRef holding its
+ * kind and its index in that array. A node's children are a range of
+ * the shared children array, so walking them is a sequential scan, and
+ * a pass interested in one kind of node (every Call, say) can just run
+ * down that kind's array. Source locations, which are rarely needed,
+ * are kept in side tables parallel to the node arrays.
+ *
+ * The flat tree is built from the resolved pointer tree (see
+ * Program::Resolve) by the Flatten methods of the node classes, and
+ * keeps the types and bindings Resolve worked out. What each kind of
+ * node keeps, and the order of its children, is listed with the kinds
+ * below. Children that are optional in the pointer tree are NoNode
+ * when absent, so they keep their position.
+ *
+ * FlatVisitor walks the tree, dispatching on the kind in a NodeRef
+ * with a switch rather than a virtual call per node.
+ */
+
+#ifndef _H_flatast
+#define _H_flatast
+
+#include <vector>
+#include <map>
+#include "location.h"
+#include "symtab.h"
+#include "utility.h"
+
+class Node;
+class Decl;
+class Program;
+class Type;
+
+
+    // The kinds of node, in the pointer tree's class names. For each:
+    // the children in order, then what the other fields of the node
+    // hold (name, type, decl and the value union, see FlatNode).
+    //
+    //   Program          decls
+    //   VarDecl          -                 name, declared type
+    //   FnDecl           formals, body     name, return type, intValue
+    //                                      is the number of formals
+    //   ClassDecl        extends, implements, members
+    //                                      name, intValue is the
+    //                                      number of implements
+    //   InterfaceDecl    members           name
+    //   NamedType        -                 name, the type, decl the
+    //                                      class or interface named
+    //   StmtBlock        decls, stmts      intValue is the number of decls
+    //   IfStmt           test, then, else
+    //   WhileStmt        test, body
+    //   ForStmt          init, test, step, body
+    //   BreakStmt        -
+    //   ReturnStmt       expr
+    //   PrintStmt        args
+    //
+    // Every expression has its type. Beyond that:
+    //
+    //   IntConstant, BoolConstant       intValue
+    //   DoubleConstant                  doubleValue
+    //   StringConstant                  stringValue
+    //   ArithmeticExpr ... AssignExpr   left, right; name is the operator
+    //                                   and left is NoNode if unary
+    //   ArrayAccess                     base, subscript
+    //   FieldAccess                     base; name is the field, decl
+    //                                   its declaration
+    //   Call                            base, actuals; name and decl
+    //                                   as for FieldAccess
+    //   NewArrayExpr                    size
+    //
+    // and the rest (EmptyExpr, NullConstant, This, NewExpr,
+    // ReadIntegerExpr, ReadLineExpr) have no children.
+#define FLAT_NODE_KINDS(X)                                               \
+    X(Program) X(VarDecl) X(FnDecl) X(ClassDecl) X(InterfaceDecl)       \
+    X(NamedType) X(StmtBlock) X(IfStmt) X(WhileStmt) X(ForStmt)         \
+    X(BreakStmt) X(ReturnStmt) X(PrintStmt) X(EmptyExpr)                \
+    X(IntConstant) X(DoubleConstant) X(BoolConstant) X(StringConstant)  \
+    X(NullConstant) X(ArithmeticExpr) X(RelationalExpr)                 \
+    X(EqualityExpr) X(LogicalExpr) X(AssignExpr) X(This)                \
+    X(ArrayAccess) X(FieldAccess) X(Call) X(NewExpr) X(NewArrayExpr)    \
+    X(ReadIntegerExpr) X(ReadLineExpr)
+
+#define FLAT_KIND_ENUM(name) k##name,
+typedef enum { FLAT_NODE_KINDS(FLAT_KIND_ENUM) NumFlatKinds } FlatKind;
+#undef FLAT_KIND_ENUM
+
+    // The kind in the top 8 bits, the index in the other 24.
+typedef unsigned NodeRef;
+
+
+struct FlatNode {
+    unsigned firstChild, numChildren;  // a range of FlatAst::children
+    Symbol name;                       // -1 if the kind has none
+    NodeRef decl;                      // NoNode unless bound
+    Type *type;                        // NULL if the kind has none
+    union {
+      int intValue;
+      double doubleValue;
+      const char *stringValue;
+    };
+};
+
+
+class FlatAst {
+  public:
+    static const NodeRef NoNode = 0xffffffff;
+    static const char * const kindName[NumFlatKinds];
+
+    NodeRef root;
+    std::vector<FlatNode> nodes[NumFlatKinds];
+    std::vector<yyltype> locations[NumFlatKinds];  // parallel to nodes
+    std::vector<NodeRef> children;
+
+         // Flattens the whole of a program that has been resolved.
+    FlatAst(Program *program);
+
+    static FlatKind KindOf(NodeRef r)     { return (FlatKind)(r >> 24); }
+    static unsigned IndexOf(NodeRef r)    { return r & 0xffffff; }
+    FlatNode &Get(NodeRef r)              { return nodes[KindOf(r)][IndexOf(r)]; }
+    const yyltype &GetLocation(NodeRef r) { return locations[KindOf(r)][IndexOf(r)]; }
+    NodeRef Child(NodeRef r, int i)       { return children[Get(r).firstChild + i]; }
+
+         // Prints the tree, one node per line, indented by depth (this
+         // is what -d flat shows).
+    void Print();
+
+         // These are for the Flatten methods building the tree. Add
+         // appends a node of the given kind with no children and no
+         // fields set, and SetChildren gives it the children flattened
+         // so far. Flatten flattens n, or gives NoNode if n is NULL.
+         // Declare notes the node made for a declaration, and Bind
+         // asks for a node's decl to be set to the node made for
+         // decl, which might not be flattened yet; the bindings are
+         // all filled in at the end.
+    NodeRef Add(FlatKind kind, yyltype *loc);
+    void SetChildren(NodeRef r, const std::vector<NodeRef> &kids);
+    NodeRef Flatten(Node *n);
+    void Declare(Decl *decl, NodeRef r)   { declared[decl] = r; }
+    void Bind(NodeRef r, Decl *decl)      { if (decl) bindings.push_back(std::make_pair(r, decl)); }
+
+  private:
+    std::map<Decl*, NodeRef> declared;
+    std::vector<std::pair<NodeRef, Decl*> > bindings;
+};
+
+
+/* The visitor is a template over the class deriving from it, which
+ * overrides (hides, really) the Visit methods for the kinds it cares
+ * about. Each of those left alone goes to VisitNode, which by default
+ * visits the children in order. Visit itself skips NoNode.
+ */
+template <class Derived> class FlatVisitor {
+  protected:
+    FlatAst *ast;
+
+  public:
+    FlatVisitor(FlatAst *a) : ast(a) {}
+
+    void Visit(NodeRef r);
+    void VisitChildren(NodeRef r) {
+      FlatNode &n = ast->Get(r);
+      for (unsigned i = 0; i < n.numChildren; i++)
+        Visit(ast->children[n.firstChild + i]);
+    }
+    void VisitNode(NodeRef r) { VisitChildren(r); }
+
+#define FLAT_VISIT_DEFAULT(name) \
+    void Visit##name(NodeRef r) { static_cast<Derived*>(this)->VisitNode(r); }
+    FLAT_NODE_KINDS(FLAT_VISIT_DEFAULT)
+#undef FLAT_VISIT_DEFAULT
+};
+
+template <class Derived> void FlatVisitor<Derived>::Visit(NodeRef r)
+{
+  if (r == FlatAst::NoNode) return;
+  Derived *d = static_cast<Derived*>(this);
+  switch (FlatAst::KindOf(r)) {
+#define FLAT_VISIT_CASE(name) case k##name: d->Visit##name(r); break;
+    FLAT_NODE_KINDS(FLAT_VISIT_CASE)
+#undef FLAT_VISIT_CASE
+    default: Failure("Bad kind %d in flat node", FlatAst::KindOf(r));
+  }
+}
+
+#endif
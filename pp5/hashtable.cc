@@ -2,44 +2,144 @@
  * ------------------
  * Implementation of Hashtable class.
  */
-   
+
+#include <algorithm>
+#include <string.h>
+
+
+/* Hashtable::Home
+ * ---------------
+ * The slot key hashes to. Symbols are small consecutive integers, so
+ * multiplying by 2^32 divided by the golden ratio spreads them out
+ * before masking off the low bits.
+ */
+template <class Value> int Hashtable<Value>::Home(Symbol key) const
+{
+  return ((unsigned)key * 2654435769u >> 8) & (entries.size() - 1);
+}
+
+
+/* Hashtable::Find
+ * ---------------
+ * Returns the index of key's entry or -1. Robin Hood order means we
+ * can stop as soon as we pass an entry closer to its home slot than
+ * key's entry would be to ours.
+ */
+template <class Value> int Hashtable<Value>::Find(Symbol key) const
+{
+  if (numKeys == 0) return -1;
+  int mask = entries.size() - 1;
+  for (int i = Home(key), d = 0; entries[i].distance >= d; i = (i + 1) & mask, d++)
+    if (entries[i].key == key) return i;
+  return -1;
+}
+
+
+/* Hashtable::Insert
+ * -----------------
+ * Places an entry for a key not yet in the table. Whenever the entry
+ * being placed is further from home than the one in the slot, they
+ * trade places, which keeps every probe sequence short.
+ */
+template <class Value> void Hashtable<Value>::Insert(Entry e)
+{
+  if (4 * (numKeys + 1) > 3 * entries.size()) Grow();
+  int mask = entries.size() - 1;
+  e.distance = 0;
+  for (int i = Home(e.key); ; i = (i + 1) & mask, e.distance++) {
+    if (entries[i].distance == -1) {
+      entries[i] = e;
+      numKeys++;
+      return;
+    }
+    if (entries[i].distance < e.distance) std::swap(entries[i], e);
+  }
+}
+
+
+/* Hashtable::Delete
+ * -----------------
+ * Empties slot index, then shifts the entries after it back by one
+ * until one is found in its home slot (or an empty one), so there are
+ * never any holes inside a probe sequence.
+ */
+template <class Value> void Hashtable<Value>::Delete(int index)
+{
+  int mask = entries.size() - 1;
+  int next = (index + 1) & mask;
+  while (entries[next].distance > 0) {
+    entries[index] = entries[next];
+    entries[index].distance--;
+    index = next;
+    next = (next + 1) & mask;
+  }
+  entries[index].distance = -1;
+  numKeys--;
+}
+
+
+template <class Value> void Hashtable<Value>::Grow()
+{
+  std::vector<Entry> old;
+  old.swap(entries);
+  Entry empty = {0, -1, NULL, NULL};
+  entries.assign(old.empty() ? 8 : 2 * old.size(), empty);
+  numKeys = 0;
+  for (int i = 0; i < old.size(); i++)
+    if (old[i].distance != -1) Insert(old[i]);
+}
+
 
 /* Hashtable::Enter
  * ----------------
  * Stores new value for given identifier. If the key already
  * has an entry and flag is to overwrite, will remove previous entry first,
- * otherwise it just adds another entry under same key. Copies the
- * key, so you don't have to worry about its allocation.
+ * otherwise it just adds another entry under same key.
  */
-template <class Value> void Hashtable<Value>::Enter(const char *key, Value val, bool overwrite)
+template <class Value> void Hashtable<Value>::Enter(Symbol key, Value val, bool overwrite)
 {
-  Value prev;
-  if (overwrite && (prev = Lookup(key)))
-    Remove(key, prev);
-  mmap.insert(std::make_pair(strdup(key), val));
+  int i = Find(key);
+  if (i == -1) {
+    Entry e = {key, 0, val, NULL};
+    Insert(e);
+  } else if (overwrite) {
+    entries[i].value = val;
+    return;
+  } else {
+    if (!entries[i].shadowed) entries[i].shadowed = new std::vector<Value>;
+    entries[i].shadowed->push_back(entries[i].value);
+    entries[i].value = val;
+  }
+  numValues++;
 }
 
- 
+
 /* Hashtable::Remove
  * -----------------
  * Removes a given key-value pair from table. If no such pair, no
  * changes are made.  Does not affect any other entries under that key.
  */
-template <class Value> void Hashtable<Value>::Remove(const char *key, Value val)
+template <class Value> void Hashtable<Value>::Remove(Symbol key, Value val)
 {
-  if (mmap.count(key) == 0) // no matches at all
-    return;
-
-  typename std::multimap<const char *, Value>::iterator itr;
-  itr = mmap.find(key); // start at first occurrence
-  while (itr != mmap.upper_bound(key)) {
-    if (itr->second == val) { // iterate to find matching pair
-	mmap.erase(itr);
-	break;
+  int i = Find(key);
+  if (i == -1) return;
+  std::vector<Value> *shadowed = entries[i].shadowed;
+  if (entries[i].value == val) {
+    if (shadowed && !shadowed->empty()) {
+      entries[i].value = shadowed->back();
+      shadowed->pop_back();
+    } else {
+      delete shadowed;
+      Delete(i);
     }
-    ++itr;
+  } else {
+    if (!shadowed) return;
+    typename std::vector<Value>::iterator p = std::find(shadowed->begin(), shadowed->end(), val);
+    if (p == shadowed->end()) return;
+    shadowed->erase(p);
   }
-} 
+  numValues--;
+}
 
 
 /* Hashtable::Lookup
@@ -47,23 +147,10 @@ template <class Value> void Hashtable<Value>::Remove(const char *key, Value val)
  * Returns the value earlier stored under key or NULL
  *if there is no matching entry
  */
-template <class Value> Value Hashtable<Value>::Lookup(const char *key) 
+template <class Value> Value Hashtable<Value>::Lookup(Symbol key)
 {
-  Value found = NULL;
-  
-  if (mmap.count(key) > 0) {
-    typename std::multimap<const char *, Value>::iterator cur, last, prev;
-    cur = mmap.find(key); // start at first occurrence
-    last = mmap.upper_bound(key);
-    while (cur != last) { // iterate to find last entered
-	prev = cur; 
-	if (++cur == mmap.upper_bound(key)) { // have to go one too far
-	  found = prev->second; // one before last was it
-	  break;
-	}
-    }
-  }
-  return found;
+  int i = Find(key);
+  return i == -1 ? NULL : entries[i].value;
 }
 
 
@@ -72,18 +159,42 @@ template <class Value> Value Hashtable<Value>::Lookup(const char *key)
  */
 template <class Value> int Hashtable<Value>::NumEntries() const
 {
-  return mmap.size();
+  return numValues;
 }
 
 
+static inline bool KeyNameLess(const std::pair<Symbol, int> &a,
+                               const std::pair<Symbol, int> &b)
+{
+  return strcmp(SymbolTable::Name(a.first), SymbolTable::Name(b.first)) < 0;
+}
 
 /* Hashtable:GetIterator
  * ---------------------
  * Returns iterator which can be used to walk through all values in table.
+ * Each key's values come out oldest first, as they were entered.
  */
-template <class Value> Iterator<Value> Hashtable<Value>::GetIterator() 
+template <class Value> Iterator<Value> Hashtable<Value>::GetIterator(bool sorted)
 {
-  return Iterator<Value>(mmap);
+  std::vector<int> order;
+  for (int i = 0; i < entries.size(); i++)
+    if (entries[i].distance != -1) order.push_back(i);
+  if (sorted) {
+    std::vector<std::pair<Symbol, int> > keys;
+    for (int i = 0; i < order.size(); i++)
+      keys.push_back(std::make_pair(entries[order[i]].key, order[i]));
+    std::stable_sort(keys.begin(), keys.end(), KeyNameLess);
+    for (int i = 0; i < keys.size(); i++) order[i] = keys[i].second;
+  }
+
+  Iterator<Value> iter;
+  for (int i = 0; i < order.size(); i++) {
+    Entry &e = entries[order[i]];
+    if (e.shadowed)
+      iter.values.insert(iter.values.end(), e.shadowed->begin(), e.shadowed->end());
+    iter.values.push_back(e.value);
+  }
+  return iter;
 }
 
 
@@ -94,6 +205,5 @@ template <class Value> Iterator<Value> Hashtable<Value>::GetIterator()
  */
 template <class Value> Value Iterator<Value>::GetNextValue()
 {
-  return (cur == end ? NULL : (*cur++).second);
+  return (cur == values.size() ? NULL : values[cur++]);
 }
-
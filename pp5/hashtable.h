@@ -1,12 +1,9 @@
 /* File: hashtable.h
  * -----------------
- * This is a simple table for storing values associated with a string
- * key, supporting simple operations for Enter and Lookup.  It is not
- * much more than a thin cover over the STL associative map container,
- * but hides the awkward C++ template syntax and provides a more
- * familiar interface.
- *
- * The keys are always strings, but the values can be of any type
+ * This is a simple table for storing values associated with a name
+ * key, supporting simple operations for Enter and Lookup. The keys are
+ * always names, given as their interned Symbol (see symtab.h), so that
+ * comparing them is comparing integers, but the values can be of any type
  * (ok, that's actually kind of a fib, it expects the type to be
  * some sort of pointer to conform to using NULL for "not found").
  * The typename for a Hashtable includes the value type in angle
@@ -16,9 +13,15 @@
  * The same notation is used on the matching iterator for the table,
  * i.e. a Hashtable<char*> supports an Iterator<char*>.
  *
+ * The table is an open-addressing hash table using Robin Hood linear
+ * probing: entries sit in one flat array, each within a few slots of
+ * where its key hashes to, so a lookup touches one or two cache lines.
+ * A key has one entry; values it shadows hang off that entry.
+ *
  * An iterator is provided for iterating over the entries in a table. 
- * The iterator walks through the values, one by one, in alphabetical
- * order by the key. Sample iteration usage:
+ * The iterator walks through the values, one by one, in no particular
+ * order, or if asked for, in alphabetical order by the key. Sample
+ * iteration usage:
  *
  *       void PrintNames(Hashtable<Decl*> *table)
  *       {
@@ -33,13 +36,9 @@
 #ifndef _H_hashtable
 #define _H_hashtable
 
-#include <map>
-#include <string.h>
-
-struct ltstr {
-  bool operator()(const char* s1, const char* s2) const
-  { return strcmp(s1, s2) < 0; }
-};
+#include <vector>
+#include <stddef.h>  // for NULL
+#include "symtab.h"
 
 
 template <class Value> class Iterator;
@@ -47,11 +46,24 @@ template <class Value> class Iterator;
 template<class Value> class Hashtable {
 
   private: 
-     std::multimap<const char*, Value, ltstr> mmap;
+     struct Entry {
+       Symbol key;
+       int distance;                   // from the home slot, -1 if empty
+       Value value;                    // the one entered last
+       std::vector<Value> *shadowed;   // earlier ones, oldest first
+     };
+     std::vector<Entry> entries;
+     int numKeys, numValues;
+
+     int Home(Symbol key) const;
+     int Find(Symbol key) const;
+     void Insert(Entry e);
+     void Delete(int index);
+     void Grow();
  
    public:
             // ctor creates a new empty hashtable
-     Hashtable() {}
+     Hashtable() : numKeys(0), numValues(0) {}
 
            // Returns number of entries currently in table
      int NumEntries() const;
@@ -62,23 +74,24 @@ template<class Value> class Hashtable {
            // from the table entirely) or just shadows it (keeps previous
            // and adds additional entry). The lastmost entered one for an
            // key will be the one returned by Lookup.
-     void Enter(const char *key, Value value,
+     void Enter(Symbol key, Value value,
 		    bool overwriteInsteadOfShadow = true);
 
            // Removes a given key->value pair.  Any other values
            // for that key are not affected. If this is the last
            // remaining value for that key, the key is removed
            // entirely.
-     void Remove(const char *key, Value value);
+     void Remove(Symbol key, Value value);
 
           // Returns value stored under key or NULL if no match.
           // If more than one value for key (ie shadow feature was
           // used during Enter), returns the lastmost entered one.
-     Value Lookup(const char *key);
+     Value Lookup(Symbol key);
 
           // Returns an Iterator object (see below) that can be used to
-          // visit each value in the table in alphabetical order.
-     Iterator<Value> GetIterator();
+          // visit each value in the table, in alphabetical order by
+          // key if sorted is true.
+     Iterator<Value> GetIterator(bool sorted = false);
 
 };
 
@@ -91,9 +104,9 @@ template<class Value> class Iterator {
   friend class Hashtable<Value>;
 
   private:
-    typename std::multimap<const char*, Value , ltstr>::iterator cur, end;
-    Iterator(std::multimap<const char*, Value, ltstr>& t)
-      : cur(t.begin()), end(t.end()) {}
+    std::vector<Value> values;
+    int cur;
+    Iterator() : cur(0) {}
 
   public:
          // Returns current value and advances iterator to next.
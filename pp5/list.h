@@ -2,10 +2,16 @@
  * ------------
  * Simple list class for storing a linear collection of elements. It
  * supports operations similar in name to the CS107 DArray -- nth, insert,
- * append, remove, etc.  This class is nothing more than a very thin
- * cover of a STL deque, with some added range-checking. Given not everyone
- * is familiar with the C++ templates, this class provides a more familiar
- * interface.
+ * append, remove, etc.  Given not everyone is familiar with the C++
+ * templates, this class provides a more familiar interface.
+ *
+ * Most lists in a parse tree (formals, actuals, the statements of a
+ * small block) hold only a few elements, so a List keeps its first
+ * InlineCapacity elements inside the List object itself and only moves
+ * them out to a larger array, allocated in the Arena, when it outgrows
+ * that. The elements are always contiguous, so an Element* serves as an
+ * iterator. Elements are copied around with plain assignment and are
+ * never destroyed, which suits the pointers and scalars lists hold.
  *
  * It can handle elements of any type, the typename for a List includes the
  * element type in angle brackets, e.g.  to store elements of type double,
@@ -28,8 +34,8 @@
 #ifndef _H_list
 #define _H_list
 
-#include <deque>
 #include "utility.h"  // for Assert()
+#include "arena.h"
 #include "scope.h"
   
 class Node;
@@ -37,37 +43,72 @@ class Node;
 template<class Element> class List {
 
  private:
-    std::deque<Element> elems;
+    static const int InlineCapacity = 4;
+    Element *elems;
+    int numElems, capacity;
+    Element inlineElems[InlineCapacity];
+
+    void Reserve(int needed)
+        { if (needed <= capacity) return;
+          while (capacity < needed) capacity *= 2;
+          Element *grown = (Element *)Arena::Allocate(capacity * sizeof(Element));
+          for (int i = 0; i < numElems; i++) grown[i] = elems[i];
+          elems = grown; }
 
  public:
+    ArenaAllocated
+
+    typedef Element *iterator;
+    typedef const Element *const_iterator;
+
            // Create a new empty list
-    List() {}
+    List() : elems(inlineElems), numElems(0), capacity(InlineCapacity) {}
+
+    List(const List &other) : elems(inlineElems), numElems(0), capacity(InlineCapacity)
+        { *this = other; }
+
+    List &operator=(const List &other)
+        { if (this != &other) {
+            Reserve(other.numElems);
+            for (int i = 0; i < other.numElems; i++) elems[i] = other.elems[i];
+            numElems = other.numElems;
+          }
+          return *this; }
 
            // Returns count of elements currently in list
     int NumElements() const
-	{ return elems.size(); }
+	{ return numElems; }
 
           // Returns element at index in list. Indexing is 0-based.
-          // Raises an assert if index is out of range.
+          // Not range checked: this is on every walk over the tree.
     Element Nth(int index) const
-	{ Assert(index >= 0 && index < NumElements());
-	  return elems[index]; }
+	{ return elems[index]; }
 
           // Inserts element at index, shuffling over others
           // Raises assert if index out of range
     void InsertAt(const Element &elem, int index)
 	{ Assert(index >= 0 && index <= NumElements());
-	  elems.insert(elems.begin() + index, elem); }
+	  Reserve(numElems + 1);
+	  for (int i = numElems; i > index; i--) elems[i] = elems[i - 1];
+	  elems[index] = elem;
+	  numElems++; }
 
           // Adds element to list end
     void Append(const Element &elem)
-	{ elems.push_back(elem); }
+	{ Reserve(numElems + 1);
+	  elems[numElems++] = elem; }
 
          // Removes element at index, shuffling down others
          // Raises assert if index out of range
     void RemoveAt(int index)
 	{ Assert(index >= 0 && index < NumElements());
-	  elems.erase(elems.begin() + index); }
+	  for (int i = index + 1; i < numElems; i++) elems[i - 1] = elems[i];
+	  numElems--; }
+
+    iterator begin()                { return elems; }
+    iterator end()                  { return elems + numElems; }
+    const_iterator begin() const    { return elems; }
+    const_iterator end() const      { return elems + numElems; }
           
        // These are some specific methods useful for lists of ast nodes
        // They will only work on lists of elements that respond to the
@@ -75,11 +116,11 @@ template<class Element> class List {
        // you can still have Lists of ints, chars*, as long as you 
        // don't try to SetParentAll on that list.
     void SetParentAll(Node *p)
-        { for (int i = 0; i < NumElements(); i++)
-             Nth(i)->SetParent(p); }
+        { for (iterator i = begin(); i != end(); ++i)
+             (*i)->SetParent(p); }
     void DeclareAll(Scope *s)
-        { for (int i = 0; i < NumElements(); i++)
-            s->Declare(Nth(i)); }
+        { for (iterator i = begin(); i != end(); ++i)
+            s->Declare(*i); }
 
 };
 
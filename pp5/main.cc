@@ -9,6 +9,7 @@
 #include "utility.h"
 #include "errors.h"
 #include "parser.h"
+#include "arena.h"
 
 
 /* Function: main()
@@ -18,6 +19,8 @@
  * InitScanner() is used to set up the scanner.
  * InitParser() is used to set up the parser. The call to yyparse() will
  * attempt to parse a complete program from the input. 
+ * Everything the front end allocated lives in the Arena and is
+ * released in one go at the end.
  */
 int main(int argc, char *argv[])
 {
@@ -26,6 +29,7 @@ int main(int argc, char *argv[])
     InitScanner();
     InitParser();
     yyparse();
+    Arena::Release();
     return (ReportError::NumErrors() == 0? 0 : -1);
 }
 
@@ -0,0 +1,307 @@
+/* File: memopt.cc
+ * ---------------
+ * Redundant load and dead store elimination, driven by a type-based
+ * alias analysis.
+ *
+ * A memory reference is a base location plus a constant byte offset
+ * together with the alias class the front end attached to the Load or
+ * Store (see tac.h). Two references may touch the same word unless
+ *   - they use the same base and different offsets, or
+ *   - both carry an alias class and the classes differ, or
+ *   - both are field accesses in the same class at different offsets.
+ * Since a field's alias class is the class that declares it, a field
+ * reached through a subclass reference still gets the same class.
+ * Array elements are reached through computed addresses, so two
+ * elements of the same array type always may alias.
+ *
+ * Calls to user functions and methods may read or write any object.
+ * The runtime built-ins never touch object or array memory, so they
+ * are transparent to both passes.
+ */
+
+#include "optimizer.h"
+#include "codegen.h"
+#include <string.h>
+
+struct MemRef {
+  Location *base;
+  int offset;
+  const char *aliasClass;
+  MemRef(Location *b, int o, const char *ac) : base(b), offset(o), aliasClass(ac) {}
+};
+
+    // Identifies the word a reference touches, ignoring its alias class
+struct MemRefLess {
+  bool operator()(const MemRef &a, const MemRef &b) const {
+    LocationLess less;
+    if (less(a.base, b.base)) return true;
+    if (less(b.base, a.base)) return false;
+    return a.offset < b.offset;
+  }
+};
+
+typedef std::map<MemRef, Location*, MemRefLess> MemContents;
+typedef std::set<MemRef, MemRefLess> MemRefSet;
+
+
+static bool SameLocation(Location *a, Location *b)
+{
+  LocationLess less;
+  return !less(a, b) && !less(b, a);
+}
+
+static bool IsArrayClass(const char *aliasClass)
+{
+  int len = strlen(aliasClass);
+  return len >= 2 && !strcmp(aliasClass + len - 2, "[]");
+}
+
+static bool MayAlias(const MemRef &a, const MemRef &b)
+{
+  if (SameLocation(a.base, b.base))
+    return a.offset == b.offset;
+  if (a.aliasClass && b.aliasClass) {
+    if (strcmp(a.aliasClass, b.aliasClass)) return false;
+    if (!IsArrayClass(a.aliasClass) && a.offset != b.offset) return false;
+  }
+  return true;
+}
+
+static bool ClobbersMemory(Instruction *instr)
+{
+  LCall *lc = dynamic_cast<LCall*>(instr);
+  if (lc) return CodeGenerator::BuiltInForLabel(lc->GetLabel()) == NumBuiltIns;
+  return dynamic_cast<ACall*>(instr) != NULL;
+}
+
+
+/* Function: Forget
+ * ----------------
+ * Drops what we know about memory once loc is assigned: addresses
+ * based on loc now point elsewhere, and values copied into loc are gone.
+ */
+static void Forget(MemContents &contents, Location *loc)
+{
+  MemContents::iterator p = contents.begin();
+  while (p != contents.end()) {
+    if (SameLocation(p->first.base, loc) || SameLocation(p->second, loc))
+      contents.erase(p++);
+    else ++p;
+  }
+}
+
+static void ForgetAliases(MemContents &contents, const MemRef &ref)
+{
+  MemContents::iterator p = contents.begin();
+  while (p != contents.end()) {
+    if (MayAlias(p->first, ref)) contents.erase(p++);
+    else ++p;
+  }
+}
+
+static void Meet(MemContents &contents, MemContents &other)
+{
+  MemContents::iterator p = contents.begin();
+  while (p != contents.end()) {
+    MemContents::iterator q = other.find(p->first);
+    if (q == other.end() || !SameLocation(q->second, p->second)) contents.erase(p++);
+    else ++p;
+  }
+}
+
+static bool SameContents(MemContents &a, MemContents &b)
+{
+  if (a.size() != b.size()) return false;
+  for (MemContents::iterator p = a.begin(), q = b.begin(); p != a.end(); ++p, ++q)
+    if (MemRefLess()(p->first, q->first) || MemRefLess()(q->first, p->first)
+        || !SameLocation(p->second, q->second))
+      return false;
+  return true;
+}
+
+
+/* Function: ForwardBlock
+ * ----------------------
+ * Simulates b starting from the memory contents known on entry. If
+ * rewrite is set, each Load of a word whose contents are known is
+ * replaced with a copy from the location that already holds them.
+ */
+static void ForwardBlock(BasicBlock *b, MemContents &contents, bool rewrite)
+{
+  for (int i = 0; i < b->code.size(); i++) {
+    Instruction *instr = b->code[i];
+    if (Load *ld = dynamic_cast<Load*>(instr)) {
+      MemRef ref(ld->GetReference(), ld->GetOffset(), ld->GetAliasClass());
+      MemContents::iterator known = contents.find(ref);
+      if (rewrite && known != contents.end())
+        b->code[i] = new Assign(ld->GetDst(), known->second);
+      Forget(contents, ld->GetDst());
+      if (!SameLocation(ld->GetDst(), ref.base))
+        contents.insert(std::make_pair(ref, ld->GetDst()));
+    } else if (Store *st = dynamic_cast<Store*>(instr)) {
+      MemRef ref(st->GetReference(), st->GetOffset(), st->GetAliasClass());
+      ForgetAliases(contents, ref);
+      contents.insert(std::make_pair(ref, st->GetValue()));
+    } else if (ClobbersMemory(instr)) {
+      contents.clear();
+    } else if (instr->GetDst()) {
+      Forget(contents, instr->GetDst());
+    }
+  }
+}
+
+
+/* Function: EliminateRedundantLoads
+ * ---------------------------------
+ * Forward "available contents" dataflow: on entry to a block we know a
+ * word's contents only if every predecessor agrees on which location
+ * holds them. Predecessors not yet visited are skipped (optimistic
+ * start), and the blocks are revisited in reverse postorder until
+ * nothing changes. A final sweep then does the rewriting.
+ */
+static MemContents ContentsOnEntry(BasicBlock *b, std::vector<MemContents> &out,
+                                   std::vector<bool> &visited)
+{
+  MemContents contents;
+  bool first = (b->num != 0);      // nothing is known on entry to the function
+  for (int i = 0; i < b->preds.size(); i++) {
+    if (!visited[b->preds[i]->num]) continue;
+    if (first) contents = out[b->preds[i]->num];
+    else Meet(contents, out[b->preds[i]->num]);
+    first = false;
+  }
+  return contents;
+}
+
+void EliminateRedundantLoads(FlowGraph *graph)
+{
+  std::vector<BasicBlock*> order;
+  std::vector<MemContents> out(graph->NumBlocks());
+  std::vector<bool> visited(graph->NumBlocks(), false);
+  graph->ReversePostorder(&order);
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = 0; k < order.size(); k++) {
+      BasicBlock *b = order[k];
+      MemContents contents = ContentsOnEntry(b, out, visited);
+      ForwardBlock(b, contents, false);
+      if (!visited[b->num] || !SameContents(contents, out[b->num])) {
+        out[b->num] = contents;
+        visited[b->num] = changed = true;
+      }
+    }
+  }
+  for (int k = 0; k < order.size(); k++) {
+    MemContents contents = ContentsOnEntry(order[k], out, visited);
+    ForwardBlock(order[k], contents, true);
+  }
+}
+
+
+static bool SameRefs(MemRefSet &a, MemRefSet &b)
+{
+  if (a.size() != b.size()) return false;
+  for (MemRefSet::iterator p = a.begin(), q = b.begin(); p != a.end(); ++p, ++q)
+    if (MemRefLess()(*p, *q) || MemRefLess()(*q, *p)) return false;
+  return true;
+}
+
+
+/* Function: BackwardBlock
+ * -----------------------
+ * Walks b from its end back to its start. overwritten holds the words
+ * that are certain to be stored to again before anything reads them;
+ * a Store to such a word is dead and is deleted if rewrite is set.
+ */
+static void BackwardBlock(BasicBlock *b, MemRefSet &overwritten, bool rewrite)
+{
+  std::vector<Instruction*> code;
+  for (int i = b->code.size() - 1; i >= 0; i--) {
+    Instruction *instr = b->code[i];
+    Store *st = dynamic_cast<Store*>(instr);
+    Load *ld = dynamic_cast<Load*>(instr);
+    if (st) {
+      MemRef ref(st->GetReference(), st->GetOffset(), st->GetAliasClass());
+      if (overwritten.count(ref) && rewrite) continue;
+      overwritten.insert(ref);
+    } else if (ClobbersMemory(instr) || dynamic_cast<Return*>(instr)) {
+      overwritten.clear();
+    }
+    if (Location *dst = instr->GetDst()) {
+      MemRefSet::iterator p = overwritten.begin();
+      while (p != overwritten.end()) {
+        if (SameLocation(p->base, dst)) overwritten.erase(p++);
+        else ++p;
+      }
+    }
+    if (ld) {
+      MemRef ref(ld->GetReference(), ld->GetOffset(), ld->GetAliasClass());
+      MemRefSet::iterator p = overwritten.begin();
+      while (p != overwritten.end()) {
+        if (MayAlias(*p, ref)) overwritten.erase(p++);
+        else ++p;
+      }
+    }
+    code.push_back(instr);
+  }
+  if (rewrite) b->code.assign(code.rbegin(), code.rend());
+}
+
+
+/* Function: EliminateDeadStores
+ * -----------------------------
+ * Backward "must be overwritten" dataflow: on exit from a block a word
+ * counts as overwritten only if it is on every path out, and nothing
+ * is on the way out of the function. As above, successors not yet
+ * visited are skipped until the iteration settles. A block with no
+ * visited successor starts out empty, so a set can grow as well as
+ * shrink between passes, and only comparing the words themselves
+ * tells whether it changed.
+ */
+static MemRefSet OverwrittenOnExit(BasicBlock *b, std::vector<MemRefSet> &in,
+                                   std::vector<bool> &visited)
+{
+  MemRefSet overwritten;
+  bool first = true;
+  for (int i = 0; i < b->succs.size(); i++) {
+    BasicBlock *s = b->succs[i];
+    if (!visited[s->num]) continue;
+    if (first) overwritten = in[s->num];
+    else {
+      MemRefSet both;
+      for (MemRefSet::iterator p = overwritten.begin(); p != overwritten.end(); ++p)
+        if (in[s->num].count(*p)) both.insert(*p);
+      overwritten = both;
+    }
+    first = false;
+  }
+  return overwritten;
+}
+
+void EliminateDeadStores(FlowGraph *graph)
+{
+  std::vector<BasicBlock*> order;
+  std::vector<MemRefSet> in(graph->NumBlocks());
+  std::vector<bool> visited(graph->NumBlocks(), false);
+  graph->ReversePostorder(&order);
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = order.size() - 1; k >= 0; k--) {
+      BasicBlock *b = order[k];
+      MemRefSet overwritten = OverwrittenOnExit(b, in, visited);
+      BackwardBlock(b, overwritten, false);
+      if (!visited[b->num] || !SameRefs(overwritten, in[b->num])) {
+        in[b->num] = overwritten;
+        visited[b->num] = changed = true;
+      }
+    }
+  }
+  for (int k = order.size() - 1; k >= 0; k--) {
+    MemRefSet overwritten = OverwrittenOnExit(order[k], in, visited);
+    BackwardBlock(order[k], overwritten, true);
+  }
+}
@@ -32,12 +32,24 @@ static bool LocationsAreSame(Location *var1, Location *var2)
 {
    return (var1 == var2 ||
 	     (var1 && var2
-		&& !strcmp(var1->GetName(), var2->GetName())
+		&& var1->GetSymbol() == var2->GetSymbol()
 		&& var1->GetSegment()  == var2->GetSegment()
 		&& var1->GetOffset() == var2->GetOffset()));
 }
 
 
+/* Method: NoteLocation
+ * --------------------
+ * Keeps track of how far the global variables we touch extend past
+ * $gp, which the garbage collector needs to know to scan them.
+ */
+void Mips::NoteLocation(Location *var)
+{
+  if (var->GetSegment() == gpRelative && var->GetOffset() + 4 > globalBytes)
+    globalBytes = var->GetOffset() + 4;
+}
+
+
 /* Method: SpillRegister
  * ---------------------
  * Used to spill a register from reg to dst.  All it does is emit a store
@@ -46,6 +58,7 @@ static bool LocationsAreSame(Location *var1, Location *var2)
 void Mips::SpillRegister(Location *dst, Register reg)
 {
   Assert(dst);
+  NoteLocation(dst);
   const char *offsetFromWhere = dst->GetSegment() == fpRelative? regs[fp].name : regs[gp].name;
   Assert(dst->GetOffset() % 4 == 0); // all variables are 4 bytes in size
   Emit("sw %s, %d(%s)\t# spill %s from %s to %s%+d", regs[reg].name,
@@ -61,6 +74,7 @@ void Mips::SpillRegister(Location *dst, Register reg)
 void Mips::FillRegister(Location *src, Register reg)
 {
   Assert(src);
+  NoteLocation(src);
   const char *offsetFromWhere = src->GetSegment() == fpRelative? regs[fp].name : regs[gp].name;
   Assert(src->GetOffset() % 4 == 0); // all variables are 4 bytes in size
   Emit("lw %s, %d(%s)\t# fill %s to %s from %s%+d", regs[reg].name,
@@ -105,21 +119,34 @@ void Mips::EmitLoadConstant(Location *dst, int val)
   SpillRegister(dst, rd);
 }
 
+// Helper to find the length of a quoted string literal as the assembler
+// will store it, where a backslash and the character after it are one
+static int LiteralLength(const char *str)
+{
+  int length = 0;
+  for (const char *p = str + 1; *p && *p != '"'; p++, length++)
+    if (*p == '\\' && p[1]) p++;
+  return length;
+}
+
+
 /* Method: EmitLoadStringConstant
  * ------------------------------
- * Used to assign a variable a pointer to string constant. Emits
- * assembly directives to create a new null-terminated string in the
- * data segment and assigns it a unique label. Slaves dst into a register
- * and loads that label address into the register.
+ * Used to assign a variable a pointer to string constant. Identical
+ * literals share a single label, so the string itself is only recorded
+ * here and laid out in the data segment by EmitPostamble. Slaves dst
+ * into a register and loads that label address into the register.
  */
 void Mips::EmitLoadStringConstant(Location *dst, const char *str)
 {
-  static int strNum = 1;
-  char label[16];
-  sprintf(label, "_string%d", strNum++);
-  Emit(".data\t\t\t# create string constant marked with label");
-  Emit("%s: .asciiz %s", label, str);
-  Emit(".text");
+  std::map<std::string, int>::iterator known = stringIndex.find(str);
+  int index = known != stringIndex.end() ? known->second : pooledStrings.size();
+  if (known == stringIndex.end()) {
+    stringIndex[str] = index;
+    pooledStrings.push_back(str);
+  }
+  char label[32];
+  sprintf(label, "_string%d", index + 1);
   EmitLoadLabel(dst, label);
 }
 
@@ -211,7 +238,7 @@ void Mips::EmitBinaryOp(BinaryOp::OpCode code, Location *dst,
  */
 void Mips::EmitLabel(const char *label)
 {
- 
+  lastLabel = label;
   Emit("%s:", label);
 }
 
@@ -285,6 +312,7 @@ void Mips::EmitCallInstr(Location *result, const char *fn, bool isLabel)
 // Two covers for the above method for specific LCall/ACall variants
 void Mips::EmitLCall(Location *dst, const char *label)
 { 
+  runtime.Require(label);
   EmitCallInstr(dst, label, true);
 }
 
@@ -318,10 +346,15 @@ void Mips::EmitPopParams(int bytes)
  * which is to remove our locals/temps from the stack, remove
  * saved registers ($fp and $ra) and restore previous values of
  * $fp and $ra so everything is returned to the state we entered.
- * We then emit jr to jump to the saved $ra.
+ * We then emit jr to jump to the saved $ra. Leaving main ends the
+ * program, so there we first write out any output still buffered.
  */
  void Mips::EmitReturn(Location *returnVal)
 { 
+  if (inMain) {
+    runtime.RequireFlushAtExit();
+    Emit("jal __FlushOutput\t# write out buffered output before exiting");
+  }
   if (returnVal != NULL) 
     {
       FillRegister(returnVal, rd);
@@ -346,6 +379,7 @@ void Mips::EmitPopParams(int bytes)
 void Mips::EmitBeginFunction(int stackFrameSize)
 {
   Assert(stackFrameSize >= 0);
+  inMain = lastLabel && !strcmp(lastLabel, "main");
   Emit("subu $sp, $sp, 8\t# decrement sp to make space to save ra, fp");
   Emit("sw $fp, 8($sp)\t# save fp");
   Emit("sw $ra, 4($sp)\t# save ra");
@@ -375,12 +409,19 @@ void Mips::EmitEndFunction()
  * ------------------
  * Used to layout a vtable. Uses assembly directives to set up new
  * entry in data segment, emits label, and lays out the function
- * labels one after another.
+ * labels one after another. The interface methods come first, from
+ * the highest slot down to slot 0 right before the label, so slot n
+ * is found at -4(n+1) from it; unused slots hold 0.
  */
-void Mips::EmitVTable(const char *label, List<const char*> *methodLabels)
+void Mips::EmitVTable(const char *label, List<const char*> *methodLabels,
+                      const std::vector<const char*> &slotMethods)
 {
   Emit(".data");
   Emit(".align 2");
+  for (int i = slotMethods.size() - 1; i >= 0; i--) {
+    if (slotMethods[i]) Emit(".word %s\t\t# interface slot %d", slotMethods[i], i);
+    else Emit(".word 0\t\t# interface slot %d", i);
+  }
   Emit("%s:\t\t# label for class %s vtable", label, label);
   for (int i = 0; i < methodLabels->NumElements(); i++)
     Emit(".word %s\n", methodLabels->Nth(i));
@@ -388,6 +429,104 @@ void Mips::EmitVTable(const char *label, List<const char*> *methodLabels)
 }
 
 
+/* Method: EmitLoadSelector
+ * -------------------------
+ * Used to look up an interface method. Slaves the vtable address into
+ * a register and loads the method address from the selector's slot.
+ */
+void Mips::EmitLoadSelector(Location *dst, Location *vtable, int slot)
+{
+  FillRegister(vtable, rs);
+  Emit("lw %s, %d(%s)\t# load method from interface slot %d", regs[rd].name,
+       -4 * (slot + 1), regs[rs].name, slot);
+  SpillRegister(dst, rd);
+}
+
+
+/* Method: EmitNullCheck
+ * ---------------------
+ * Used to make sure an object reference is non-null before it is
+ * dereferenced. Slaves the reference into a register and branches to
+ * the __NullError runtime routine if it is zero, which reports the
+ * error and halts the program.
+ */
+void Mips::EmitNullCheck(Location *reference)
+{
+  runtime.Require("__NullError");
+  FillRegister(reference, rs);
+  Emit("beqz %s, __NullError\t# halt if %s is null", regs[rs].name,
+       reference->GetName());
+}
+
+
+/* Method: EmitStackAlloc
+ * ----------------------
+ * Used for an object the optimizer placed in the stack frame instead
+ * of the heap. Computes its address from the fp, clears each of its
+ * words (the heap hands out zeroed memory, so we must too) and stores
+ * the address into dst.
+ */
+void Mips::EmitStackAlloc(Location *dst, int offset, int numBytes)
+{
+  Emit("addiu %s, $fp, %d\t# address of stack-allocated object", regs[rd].name,
+       offset);
+  for (int i = 0; i < numBytes; i += 4)
+    Emit("sw $zero, %d(%s)\t# clear word of object", i, regs[rd].name);
+  SpillRegister(dst, rd);
+}
+
+
+/* Method: EmitFastCall
+ * --------------------
+ * Used for a built-in the optimizer turned into a call to the internal
+ * entry of its run-time routine. Slaves the argument into $a0, jumps to
+ * the routine and copies the result out of $v0. A halt is a call to
+ * __FlushOutput followed by the exit syscall, passed in as syscall.
+ */
+void Mips::EmitFastCall(const char *label, Location *dst, Location *arg, int syscall)
+{
+  runtime.Require(label);
+  if (arg) FillRegister(arg, a0);
+  Emit("jal %-15s\t# jump to run-time routine", label);
+  if (syscall) {
+    Emit("li $v0, %d", syscall);
+    Emit("syscall");
+  }
+  if (dst) SpillRegister(dst, v0);
+}
+
+
+/* Method: EmitInlineAlloc
+ * -----------------------
+ * Used for an allocation of constant size. Bumps __HEAPNEXT past the
+ * new block and its header word if that stays below __HEAPEND, which is
+ * all __Malloc itself would do; memory never handed out before is
+ * already zero. Otherwise calls __Malloc to reuse a freed block, collect
+ * or grow the heap.
+ */
+void Mips::EmitInlineAlloc(Location *dst, int numBytes)
+{
+  static int numSites = 0;
+  int site = ++numSites;
+  runtime.Require("__Malloc");
+  Emit("lw $v0, __HEAPNEXT\t\t# inline allocation of %d bytes", numBytes);
+  Emit("addiu %s, $v0, %d", regs[rs].name, numBytes + 4);
+  Emit("lw %s, __HEAPEND", regs[rt].name);
+  Emit("bgtu %s, %s, __heapfull%d\t# heap full, let __Malloc see to it",
+       regs[rs].name, regs[rt].name, site);
+  Emit("sw %s, __HEAPNEXT", regs[rs].name);
+  Emit("li %s, %d", regs[rt].name, numBytes);
+  Emit("sw %s, ($v0)\t\t# header word holds the size", regs[rt].name);
+  Emit("addiu $v0, $v0, 4");
+  Emit("b __allocated%d", site);
+  Emit("__heapfull%d:", site);
+  Emit("li $a0, %d", numBytes);
+  Emit("jal __Malloc");
+  Emit("__allocated%d:", site);
+  SpillRegister(dst, v0);
+}
+
+
 /* Method: EmitPreamble
  * --------------------
  * Used to emit the starting sequence needed for a program. Not much
@@ -403,6 +542,29 @@ void Mips::EmitPreamble()
 }
 
 
+/* Method: EmitPostamble
+ * ---------------------
+ * Used to end the program. Lays out the string constants, each once,
+ * in a single data section, then appends the parts of the run-time
+ * library that the code emitted so far calls on (see runtime.h).
+ * Every Decaf string is word aligned and preceded by a word holding
+ * its length (see _StringEqual in runtime.cc).
+ */
+void Mips::EmitPostamble()
+{
+  if (!pooledStrings.empty())
+    Emit(".data\t\t\t# string constants");
+  for (int i = 0; i < pooledStrings.size(); i++) {
+    Emit(".align 2");
+    Emit(".word %d\t\t# length of _string%d",
+         LiteralLength(pooledStrings[i].c_str()), i + 1);
+    Emit("_string%d: .asciiz %s", i + 1, pooledStrings[i].c_str());
+  }
+  runtime.SetGlobalBytes(globalBytes);
+  runtime.Emit();
+}
+
+
 /* Method: NameForTac
  * ------------------
  * Returns the appropriate MIPS instruction (add, seq, etc.) for
@@ -465,7 +627,9 @@ Mips::Mips() {
   regs[s6] = (RegContents){false, NULL, "$s6", true};
   regs[s7] = (RegContents){false, NULL, "$s7", true};
   rs = t0; rt = t1; rd = t2;
-
+  lastLabel = NULL;
+  inMain = false;
+  globalBytes = 0;
 }
 const char *Mips::mipsName[BinaryOp::NumOps];
 
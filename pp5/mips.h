@@ -20,6 +20,10 @@
 
 #include "tac.h"
 #include "list.h"
+#include "runtime.h"
+#include <map>
+#include <string>
+#include <vector>
 class Location;
 
 
@@ -50,6 +54,14 @@ class Mips {
     static const char *NameForTac(BinaryOp::OpCode code);
 
     Instruction* currentInstruction;
+    Runtime runtime;
+    std::map<std::string, int> stringIndex;   // literal -> pooledStrings index
+    std::vector<std::string> pooledStrings;
+    const char *lastLabel;
+    bool inMain;
+    int globalBytes;                          // extent of the globals used so far
+
+    void NoteLocation(Location *var);
  public:
     Mips();
 
@@ -79,9 +91,16 @@ class Mips {
     void EmitACall(Location *result, Location *fnAddr);
     void EmitPopParams(int bytes);
 
-    void EmitVTable(const char *label, List<const char*> *methodLabels);
+    void EmitVTable(const char *label, List<const char*> *methodLabels,
+                    const std::vector<const char*> &slotMethods);
+    void EmitLoadSelector(Location *dst, Location *vtable, int slot);
+    void EmitNullCheck(Location *reference);
+    void EmitStackAlloc(Location *dst, int offset, int numBytes);
+    void EmitFastCall(const char *label, Location *dst, Location *arg, int syscall = 0);
+    void EmitInlineAlloc(Location *dst, int numBytes);
 
     void EmitPreamble();
+    void EmitPostamble();
 
   
     class CurrentInstruction;
@@ -0,0 +1,139 @@
+/* File: nullcheck.cc
+ * ------------------
+ * Elimination of redundant NullCheck instructions.
+ *
+ * A forward dataflow analysis tracks the set of locations certain to
+ * hold a non-null reference. A location becomes known non-null
+ *   - after a NullCheck on it succeeds,
+ *   - after a Load or Store through it (a null base would have trapped),
+ *   - when it receives the result of _Alloc (i.e. a New) or of a
+ *     StackAlloc, a string constant or a label address,
+ *   - when it is copied from another known non-null location,
+ * and "this" is non-null throughout a method. Any other assignment to
+ * a location removes it from the set. Facts must hold on every path
+ * into a block, so a check is dropped when an equivalent check (or
+ * dereference) dominates it, as well as when each incoming path has
+ * its own.
+ */
+
+#include "optimizer.h"
+#include "codegen.h"
+
+
+static bool SameLocation(Location *a, Location *b)
+{
+  LocationLess less;
+  return !less(a, b) && !less(b, a);
+}
+
+
+/* Function: Transfer
+ * ------------------
+ * Updates nonNull across instr. If rewrite is set and instr is a
+ * NullCheck on a location already known non-null, returns false to
+ * tell the caller to delete it.
+ */
+static bool Transfer(Instruction *instr, LocationSet &nonNull, bool rewrite)
+{
+  if (NullCheck *nc = dynamic_cast<NullCheck*>(instr)) {
+    if (rewrite && nonNull.count(nc->GetReference())) return false;
+    nonNull.insert(nc->GetReference());
+    return true;
+  }
+
+  Location *deref = NULL, *dst = instr->GetDst();
+  bool result = false;
+  if (Load *ld = dynamic_cast<Load*>(instr))
+    deref = ld->GetReference();
+  else if (Store *st = dynamic_cast<Store*>(instr))
+    deref = st->GetReference();
+  else if (Assign *a = dynamic_cast<Assign*>(instr))
+    result = nonNull.count(a->GetSrc()) > 0;
+  else if (LCall *lc = dynamic_cast<LCall*>(instr))
+    result = CodeGenerator::BuiltInForLabel(lc->GetLabel()) == Alloc;
+  else if (dynamic_cast<LoadStringConstant*>(instr) || dynamic_cast<LoadLabel*>(instr)
+           || dynamic_cast<StackAlloc*>(instr))
+    result = true;
+
+  if (dst) {
+    if (result) nonNull.insert(dst);
+    else nonNull.erase(dst);
+  }
+  if (deref && !(dst && SameLocation(dst, deref)))
+    nonNull.insert(deref);
+  return true;
+}
+
+
+static LocationSet NonNullOnEntry(BasicBlock *b, std::vector<LocationSet> &out,
+                                  std::vector<bool> &visited, LocationSet &initial)
+{
+  LocationSet nonNull;
+  bool first = true;
+  if (b->num == 0) { nonNull = initial; first = false; }
+  for (int i = 0; i < b->preds.size(); i++) {
+    LocationSet &other = out[b->preds[i]->num];
+    if (!visited[b->preds[i]->num]) continue;
+    if (first) nonNull = other;
+    else {
+      LocationSet both;
+      for (LocationSet::iterator p = nonNull.begin(); p != nonNull.end(); ++p)
+        if (other.count(*p)) both.insert(*p);
+      nonNull = both;
+    }
+    first = false;
+  }
+  return nonNull;
+}
+
+
+/* Function: EliminateNullChecks
+ * -----------------------------
+ * Iterates in reverse postorder, skipping predecessors not yet visited,
+ * until the sets stop shrinking, then deletes the checks that are
+ * covered. "this" is seeded as non-null when the function is a method,
+ * which we recognize by it referring to CodeGenerator::ThisPtr.
+ */
+void EliminateNullChecks(FlowGraph *graph)
+{
+  std::vector<BasicBlock*> order;
+  std::vector<LocationSet> out(graph->NumBlocks());
+  std::vector<bool> visited(graph->NumBlocks(), false);
+  LocationSet initial;
+  graph->ReversePostorder(&order);
+
+  for (int k = 0; k < order.size(); k++) {
+    BasicBlock *b = order[k];
+    for (int i = 0; i < b->code.size(); i++) {
+      Location *srcs[Instruction::MaxSrcs];
+      int n = b->code[i]->GetSrcs(srcs);
+      for (int j = 0; j < n; j++)
+        if (srcs[j] == CodeGenerator::ThisPtr) initial.insert(srcs[j]);
+    }
+  }
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = 0; k < order.size(); k++) {
+      BasicBlock *b = order[k];
+      LocationSet nonNull = NonNullOnEntry(b, out, visited, initial);
+      for (int i = 0; i < b->code.size(); i++)
+        Transfer(b->code[i], nonNull, false);
+      if (!visited[b->num] || nonNull.size() != out[b->num].size()) {
+        out[b->num] = nonNull;
+        visited[b->num] = changed = true;
+      }
+    }
+  }
+
+  for (int k = 0; k < order.size(); k++) {
+    BasicBlock *b = order[k];
+    LocationSet nonNull = NonNullOnEntry(b, out, visited, initial);
+    std::vector<Instruction*> code;
+    for (int i = 0; i < b->code.size(); i++)
+      if (Transfer(b->code[i], nonNull, true))
+        code.push_back(b->code[i]);
+    b->code = code;
+  }
+}
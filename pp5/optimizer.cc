@@ -0,0 +1,48 @@
+/* File: optimizer.cc
+ * ------------------
+ * Driver for the Tac optimization passes. Each pass lives in a file
+ * of its own; optimizer.h lists them.
+ */
+
+#include "optimizer.h"
+
+
+/* Function: OptimizeCode
+ * ----------------------
+ * Unused functions are dropped and whole-program facts are gathered
+ * first, then each function body (everything between a BeginFunc and
+ * its EndFunc) is turned into a FlowGraph, optimized, and put back in
+ * place of the original instructions. Other instructions outside of
+ * functions are left untouched.
+ */
+void OptimizeCode(std::list<Instruction*> *code)
+{
+  LocationSet constantGlobals;
+  EliminateDeadFunctions(code);
+  FindConstantGlobals(code, &constantGlobals);
+
+  std::list<Instruction*>::iterator p = code->begin();
+  while (p != code->end()) {
+    BeginFunc *begin = dynamic_cast<BeginFunc*>(*p++);
+    if (!begin) continue;
+
+    std::list<Instruction*>::iterator first = p, last = p;
+    while (last != code->end() && !dynamic_cast<EndFunc*>(*last))
+      ++last;
+    Assert(last != code->end());
+    FlowGraph graph(begin, first, last);
+    PropagateConstants(&graph, constantGlobals);
+    ReplaceObjectsWithScalars(&graph);
+    AllocateOnStack(&graph);
+    EliminateNullChecks(&graph);
+    EliminateRedundantLoads(&graph);
+    EliminateDeadStores(&graph);
+    ExpandBuiltIns(&graph);
+
+    std::list<Instruction*> body;
+    graph.Linearize(&body);
+    code->erase(first, last);
+    code->splice(last, body);
+    p = last;
+  }
+}
@@ -0,0 +1,78 @@
+/* File: optimizer.h
+ * -----------------
+ * Machine-independent optimization of the Tac instruction stream.
+ * OptimizeCode is called by the CodeGenerator right before final code
+ * generation. It carves the instruction list into one FlowGraph per
+ * function (see cfg.h), runs the passes below over each of them and
+ * splices the rewritten instructions back into the list.
+ *
+ * Optimization is on by default. Passing -d noopt to dcc skips it,
+ * which is handy when checking the Tac the front end produces.
+ */
+
+#ifndef _H_optimizer
+#define _H_optimizer
+
+#include <list>
+#include "tac.h"
+#include "cfg.h"
+
+
+void OptimizeCode(std::list<Instruction*> *code);
+
+
+         // Removes the functions, methods and vtables that cannot be
+         // reached from main through calls and instantiated classes
+         // (callgraph.cc).
+void EliminateDeadFunctions(std::list<Instruction*> *code);
+
+
+         // Sparse conditional constant propagation (constprop.cc).
+         // FindConstantGlobals scans the whole program for globals that
+         // are only ever assigned zero, i.e. keep their initial value.
+         // PropagateConstants then folds operations on constants,
+         // resolves IfZ branches whose test is known and deletes the
+         // blocks that can no longer be reached.
+void FindConstantGlobals(std::list<Instruction*> *code, LocationSet *globals);
+void PropagateConstants(FlowGraph *graph, const LocationSet &constantGlobals);
+
+
+         // Memory optimizations using type-based alias analysis
+         // (memopt.cc). EliminateRedundantLoads replaces a Load with a
+         // copy when the word's contents are already in a location,
+         // because of an earlier Store or Load on every path to it.
+         // EliminateDeadStores deletes a Store whose word is stored to
+         // again on every path before anything may read it.
+void EliminateRedundantLoads(FlowGraph *graph);
+void EliminateDeadStores(FlowGraph *graph);
+
+
+         // Removes each NullCheck on a reference that is already known
+         // to be non-null on every path to it (nullcheck.cc).
+void EliminateNullChecks(FlowGraph *graph);
+
+
+         // Escape analysis (escape.cc). ObjectEscapes collects in aliases
+         // every location that may point into the object created in
+         // object, and tells whether the object can outlive or be seen
+         // outside the function. AllocateOnStack moves small objects of
+         // constant size that don't escape from the heap into the stack
+         // frame. ReplaceObjectsWithScalars, which runs first, goes
+         // further for objects only accessed at constant offsets and
+         // turns each of their fields into a temporary. FindConstantSizes
+         // maps each location assigned once, by a LoadConstant, to its
+         // value, which is how allocation sizes known at compile time
+         // are recognized.
+bool ObjectEscapes(FlowGraph *graph, Location *object, LocationSet *aliases);
+void FindConstantSizes(FlowGraph *graph, std::map<Location*,int,LocationLess> *sizes);
+void ReplaceObjectsWithScalars(FlowGraph *graph);
+void AllocateOnStack(FlowGraph *graph);
+
+
+         // Replaces each call to a built-in that has a register-based
+         // entry in the run-time library with a FastCall, or for _Alloc
+         // of a constant size, an InlineAlloc (fastcall.cc). Since the
+         // other passes look for calls to _Alloc, this one runs last.
+void ExpandBuiltIns(FlowGraph *graph);
+
+#endif
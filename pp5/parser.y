@@ -22,7 +22,7 @@ void yyerror(const char *msg); // standard error-handling routine
     bool boolConstant;
     char *stringConstant;
     double doubleConstant;
-    char identifier[MaxIdentLen+1]; // +1 for terminating null
+    Symbol identifier;              // interned name, see symtab.h
     Decl *decl;
     List<Decl*> *declList;
     Type *type;
@@ -101,6 +101,7 @@ Program   :    DeclList            {
                                       // if no errors, advance to next phase
                                       if (ReportError::NumErrors() == 0) { 
                                           program->Check();
+					  program->Resolve();
 					  program->Emit();
 				      }
                                     }
@@ -127,7 +128,7 @@ Type      :    T_Int                { $$ = Type::intType; }
           |    T_Bool               { $$ = Type::boolType; }
           |    T_String             { $$ = Type::stringType; }
           |    T_Double             { $$ = Type::doubleType; }
-          |    T_Identifier         { $$ = new NamedType(new Identifier(@1,$1)); }
+          |    T_Identifier         { $$ = new NamedType(new Identifier(@1, $1)); }
           |    Type T_Dims          { $$ = new ArrayType(Join(@1, @2), $1); }
           ;
 
@@ -188,14 +189,19 @@ FnDecl    :    FnHeader StmtBlock   { ($$=$1)->SetFunctionBody($2); }
 
 StmtBlock :    '{' VarDecls StmtList '}' 
                                     { $$ = new StmtBlock($2, $3); }
+          |    '{' VarDecls '}'     { $$ = new StmtBlock($2, new List<Stmt*>); }
           ;
 
 VarDecls  :    VarDecls VarDecl     { ($$=$1)->Append($2); }
           |    /* empty */          { $$ = new List<VarDecl*>; }
           ;
 
-StmtList  :    Stmt StmtList        { $$ = $2; $$->InsertAt($1, 0); }
-          |    /* empty */          { $$ = new List<Stmt*>; }
+  /* Left recursive, so each statement is appended in constant time.
+   * The list is never empty: allowing that would mean deciding it has
+   * started before seeing whether an identifier after the VarDecls
+   * begins another VarDecl or the first statement. */
+StmtList  :    StmtList Stmt        { ($$=$1)->Append($2); }
+          |    Stmt                 { ($$ = new List<Stmt*>)->Append($1); }
           ;
 
 Stmt      :    OptExpr ';'          { $$ = $1; }
@@ -257,7 +263,7 @@ Expr      :    LValue               { $$ = $1; }
                                     { $$ = new ReadIntegerExpr(Join(@1,@3)); }
           |    T_ReadLine '(' ')'   { $$ = new ReadLineExpr(Join(@1,@3)); }
           |    T_New '(' T_Identifier ')' 
-                                    { $$ = new NewExpr(Join(@1,@4),new NamedType(new Identifier(@3,$3))); }
+                                    { $$ = new NewExpr(Join(@1,@4),new NamedType(new Identifier(@3, $3))); }
           |    T_NewArray '(' Expr ',' Type ')' 
                                     { $$ = new NewArrayExpr(Join(@1,@6),$3, $5); }
           |    T_This               { $$ = new This(@1); }
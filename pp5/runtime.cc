@@ -0,0 +1,626 @@
+/* File: runtime.cc
+ * ----------------
+ * Implementation of the Runtime class, including the assembly for the
+ * library itself. Each piece is kept as the text spim reads, paired
+ * with the labels of the other pieces it refers to.
+ */
+
+#include "runtime.h"
+#include <stdio.h>
+#include <string.h>
+
+using std::string;
+
+
+static struct _piece {
+  const char *label;
+  bool isData;
+  const char *uses;             // labels of other pieces, space separated
+  const char *text;
+} pieces[] =
+ {{"_PrintInt", false, "__FlushOutput __OUTBUF __OUTPOS",
+"_PrintInt:\n"
+"\tsubu $sp, $sp, 8\n"
+"\tsw $fp, 8($sp)\n"
+"\tsw $ra, 4($sp)\n"
+"\taddiu $fp, $sp, 8\n"
+"\tlw $t0, __OUTPOS\n"
+"\tblt $t0, 1013, __piroom\t# need room for up to 11 characters\n"
+"\tjal __FlushOutput\n"
+"__piroom:\tlw $t3, __OUTPOS\n"
+"\tla $t4, __OUTBUF\n"
+"\taddu $t4, $t4, $t3\t# where the text goes\n"
+"\tlw $t2, 4($fp)\n"
+"\tbgez $t2, __pipos\n"
+"\tli $t5, 45\t\t# '-'\n"
+"\tsb $t5, ($t4)\n"
+"\taddi $t4, 1\n"
+"\tsubu $t2, $zero, $t2\t# magnitude, read as unsigned\n"
+"__pipos:\tmove $t6, $t4\t\t# first digit goes here\n"
+"\tli $t7, 10\n"
+"__pidigit:\n"
+"\tdivu $t2, $t7\n"
+"\tmfhi $t5\n"
+"\tmflo $t2\n"
+"\taddi $t5, 48\t\t# '0' + digit\n"
+"\tsb $t5, ($t4)\n"
+"\taddi $t4, 1\n"
+"\tbnez $t2, __pidigit\n"
+"\tla $t5, __OUTBUF\n"
+"\tsubu $t5, $t4, $t5\n"
+"\tsw $t5, __OUTPOS\n"
+"\taddi $t4, -1\t\t# the digits came out backwards, swap them\n"
+"__pirev:\tbgeu $t6, $t4, __pidone\n"
+"\tlb $t5, ($t6)\n"
+"\tlb $t7, ($t4)\n"
+"\tsb $t7, ($t6)\n"
+"\tsb $t5, ($t4)\n"
+"\taddi $t6, 1\n"
+"\taddi $t4, -1\n"
+"\tb __pirev\n"
+"__pidone:\tmove $sp, $fp\n"
+"\tlw $ra, -4($fp)\n"
+"\tlw $fp, 0($fp)\n"
+"\tjr $ra\n"},
+
+  {"_PrintString", false, "__OutputString",
+"_PrintString:\n"
+"\tsubu $sp, $sp, 8\n"
+"\tsw $fp, 8($sp)\n"
+"\tsw $ra, 4($sp)\n"
+"\taddiu $fp, $sp, 8\n"
+"\tlw $a0, 4($fp)\n"
+"\tjal __OutputString\n"
+"\tmove $sp, $fp\n"
+"\tlw $ra, -4($fp)\n"
+"\tlw $fp, 0($fp)\n"
+"\tjr $ra\n"},
+
+  {"_PrintBool", false, "__OutputString __TRUE __FALSE",
+"_PrintBool:\n"
+"\tsubu $sp, $sp, 8\n"
+"\tsw $fp, 8($sp)\n"
+"\tsw $ra, 4($sp)\n"
+"\taddiu $fp, $sp, 8\n"
+"\tlw $t1, 4($fp)\n"
+"\tla   $a0, __TRUE\t\t# address of str to print\n"
+"\tbgtz $t1, __pbout\n"
+"\tla   $a0, __FALSE\t\t# address of str to print\n"
+"__pbout:\tjal __OutputString\n"
+"\tmove $sp, $fp\n"
+"\tlw $ra, -4($fp)\n"
+"\tlw $fp, 0($fp)\n"
+"\tjr $ra\n"},
+
+  {"__OutputString", false, "__FlushOutput __OUTBUF __OUTPOS",
+"__OutputString:\t\t\t# appends the string at $a0 to __OUTBUF\n"
+"\tsubu $sp, $sp, 4\n"
+"\tsw $ra, 4($sp)\n"
+"\tmove $t2, $a0\t\t# next character to copy\n"
+"\tlw $t3, __OUTPOS\n"
+"__oscopy:\tlb $t4, ($t2)\n"
+"\tbeqz $t4, __osdone\n"
+"\tblt $t3, 1024, __osroom\n"
+"\tsw $t3, __OUTPOS\n"
+"\tjal __FlushOutput\n"
+"\tli $t3, 0\n"
+"__osroom:\tla $t5, __OUTBUF\n"
+"\taddu $t5, $t5, $t3\n"
+"\tsb $t4, ($t5)\n"
+"\taddi $t2, 1\n"
+"\taddi $t3, 1\n"
+"\tb __oscopy\n"
+"__osdone:\tsw $t3, __OUTPOS\n"
+"\tlw $ra, 4($sp)\n"
+"\taddu $sp, $sp, 4\n"
+"\tjr $ra\n"},
+
+  {"__FlushOutput", false, "__OUTBUF __OUTPOS",
+"__FlushOutput:\t\t\t# writes out __OUTBUF with a single syscall\n"
+"\tlw $t0, __OUTPOS\n"
+"\tbeqz $t0, __flushed\n"
+"\tla $a0, __OUTBUF\n"
+"\taddu $t1, $a0, $t0\n"
+"\tsb $zero, ($t1)\t\t# terminate the buffered text\n"
+"\tli $v0, 4\n"
+"\tsyscall\n"
+"\tsw $zero, __OUTPOS\n"
+"__flushed:\tjr $ra\n"},
+
+  {"_Alloc", false, "__Malloc",
+"_Alloc:\n"
+"\tsubu $sp, $sp, 8\n"
+"\tsw $fp, 8($sp)\n"
+"\tsw $ra, 4($sp)\n"
+"\taddiu $fp, $sp, 8\n"
+"\tlw $a0, 4($fp)\n"
+"\tjal __Malloc\n"
+"\tmove $sp, $fp\n"
+"\tlw $ra, -4($fp)\n"
+"\tlw $fp, 0($fp)\n"
+"\tjr $ra\n"},
+
+  // The heap allocator and collector. The heap is the memory got from
+  // sbrk in chunks of at least 64K, which SPIM hands out contiguously,
+  // so the heap is a single run of blocks. Each block is preceded by a
+  // header word holding its size in bytes, with the low bits used as
+  // flags: 1 for marked, 2 for free.
+  //
+  // New blocks are carved off the end of the heap at __HEAPNEXT, which
+  // the compiler also does inline for allocations of known size (see
+  // Mips::EmitInlineAlloc), so only when the heap is used up do we get
+  // called. Blocks the collector frees go on a free list per size if
+  // they are up to 32 words, larger ones on a single list searched
+  // first fit and split as needed. If neither has a block and at least
+  // half the heap has been allocated since the last collection,
+  // __Collect runs before the heap is grown. __Malloc is an internal
+  // entry point taking its argument in $a0.
+  //
+  // Should sbrk ever return memory that does not follow on from the
+  // heap, allocation carries on from there, but the heap is no longer
+  // a single run of blocks: walking it from __HEAPSTART to __HEAPNEXT would
+  // cross the gap, so __GCOFF is set and the collector never runs again.
+  {"__Malloc", false, "__Collect __GCRelease __FREELISTS __LARGEFREE __HEAPSTART __HEAPNEXT __HEAPEND __LASTNEXT __REUSED __GCOFF",
+"__Malloc:\t\t\t# $a0 = bytes wanted, $v0 = zeroed block\n"
+"\tsubu $sp, $sp, 12\n"
+"\tsw $ra, 12($sp)\n"
+"\tsw $zero, 4($sp)\t# whether we have collected yet\n"
+"\taddi $a0, $a0, 3\n"
+"\tsrl $t0, $a0, 2\t\t# size in words\n"
+"\tbgtz $t0, __mwords\n"
+"\tli $t0, 1\n"
+"__mwords:\tsll $a0, $t0, 2\t\t# size in bytes, rounded up\n"
+"\tsw $a0, 8($sp)\n"
+"__mretry:\tlw $a0, 8($sp)\n"
+"\tsrl $t0, $a0, 2\n"
+"\tbgt $t0, 32, __mlarge\n"
+"\tla $t1, __FREELISTS\n"
+"\tsll $t2, $t0, 2\n"
+"\taddu $t1, $t1, $t2\t# free list for this size\n"
+"\tlw $v0, ($t1)\n"
+"\tbeqz $v0, __mlarge\t# try splitting a bigger block\n"
+"\tlw $t2, ($v0)\t\t# a free block's first word links to the next\n"
+"\tsw $t2, ($t1)\n"
+"\tb __mreuse\n"
+"__mlarge:\tla $t1, __LARGEFREE\n"
+"__mfit:\tlw $v0, ($t1)\n"
+"\tbeqz $v0, __mbump\n"
+"\tlw $t2, -4($v0)\n"
+"\tsrl $t2, $t2, 2\n"
+"\tsll $t2, $t2, 2\n"
+"\tbge $t2, $a0, __mtake\n"
+"\tmove $t1, $v0\n"
+"\tb __mfit\n"
+"__mtake:\tlw $t3, ($v0)\n"
+"\tsw $t3, ($t1)\n"
+"\tsubu $t4, $t2, $a0\n"
+"\tblt $t4, 8, __mreuse\t# too little left over to split off\n"
+"\tsw $a0, -4($v0)\n"
+"\taddu $t8, $v0, $a0\t# header of what is left over\n"
+"\taddi $t4, $t4, -4\n"
+"\tori $t4, $t4, 2\n"
+"\tsw $t4, ($t8)\n"
+"\tjal __GCRelease\n"
+"__mreuse:\tlw $t2, -4($v0)\n"
+"\tsrl $t2, $t2, 2\n"
+"\tsll $t2, $t2, 2\n"
+"\tsw $t2, -4($v0)\t\t# no longer free\n"
+"\tlw $t1, __REUSED\n"
+"\taddu $t1, $t1, $t2\n"
+"\tsw $t1, __REUSED\n"
+"\tmove $t1, $v0\n"
+"\taddu $t2, $v0, $t2\n"
+"__mzero:\tsw $zero, ($t1)\n"
+"\taddi $t1, 4\n"
+"\tbltu $t1, $t2, __mzero\n"
+"\tb __mdone\n"
+"__mbump:\tlw $v0, __HEAPNEXT\n"
+"\tlw $t1, __HEAPEND\n"
+"\taddu $t2, $v0, $a0\n"
+"\taddi $t2, $t2, 4\t# end of the block, header included\n"
+"\tbleu $t2, $t1, __mfits\n"
+"\tlw $t3, 4($sp)\n"
+"\tbnez $t3, __mgrow\n"
+"\tlw $t3, __GCOFF\n"
+"\tbnez $t3, __mgrow\n"
+"\tlw $t3, __HEAPSTART\n"
+"\tbeqz $t3, __mgrow\n"
+"\tsubu $t3, $t1, $t3\t# heap size\n"
+"\tlw $t4, __REUSED\n"
+"\taddu $t4, $t4, $v0\n"
+"\tlw $t5, __LASTNEXT\n"
+"\tsubu $t4, $t4, $t5\t# bytes allocated since the last collection\n"
+"\tsll $t4, $t4, 1\n"
+"\tbltu $t4, $t3, __mgrow\n"
+"\tli $t3, 1\n"
+"\tsw $t3, 4($sp)\n"
+"\tjal __Collect\n"
+"\tb __mretry\n"
+"__mgrow:\taddi $t4, $a0, 4\n"
+"\tli $a0, 65536\n"
+"\tbge $a0, $t4, __mchunk\n"
+"\tmove $a0, $t4\n"
+"__mchunk:\tli $v0, 9\n"
+"\tsyscall\n"
+"\tlw $t1, __HEAPEND\n"
+"\tbeq $v0, $t1, __mextend\t# right after the heap, as expected\n"
+"\tsw $v0, __HEAPNEXT\n"
+"\tlw $t2, __HEAPSTART\n"
+"\tbeqz $t2, __mfirst\n"
+"\taddu $t1, $v0, $a0\t# a gap in the heap, we can't walk it now\n"
+"\tsw $t1, __HEAPEND\n"
+"\tb __mgcoff\n"
+"__mfirst:\tsw $v0, __HEAPSTART\n"
+"\tsw $v0, __LASTNEXT\n"
+"\tmove $t1, $v0\n"
+"__mextend:\taddu $t1, $t1, $a0\n"
+"\tsw $t1, __HEAPEND\n"
+"\tlw $t2, __HEAPSTART\n"
+"\tsubu $t2, $t1, $t2\n"
+"\tbleu $t2, 4194304, __mretry\t# __BLOCKMAP covers 4M of heap\n"
+"__mgcoff:\tli $t2, 1\n"
+"\tsw $t2, __GCOFF\n"
+"\tb __mretry\n"
+"__mfits:\tsw $t2, __HEAPNEXT\n"
+"\tsw $a0, ($v0)\t\t# header\n"
+"\taddi $v0, $v0, 4\t# memory fresh from sbrk is already zero\n"
+"__mdone:\tlw $ra, 12($sp)\n"
+"\taddu $sp, $sp, 12\n"
+"\tjr $ra\n"},
+
+  // The collector is conservative about roots: any word on the stack
+  // or among the globals that points into a block keeps it alive, and
+  // so does any word inside a live block. Blocks are never moved, so
+  // a non-pointer that happens to look like one only retains memory.
+  // To tell which block a word points into, we first walk the heap to
+  // fill in __BLOCKMAP, which has a bit for each heap word that starts a
+  // block. Marking uses the stack below __Collect's frame as its work
+  // list.
+  // The sweep then rebuilds the free lists from every block left
+  // unmarked, merging neighbours into a single block.
+  {"__Collect", false, "__GCMark __GCRelease __BlockBit __FREELISTS __LARGEFREE __HEAPSTART __HEAPNEXT __BLOCKMAP __LASTNEXT __REUSED __GLOBALBYTES",
+"__Collect:\n"
+"\tsubu $sp, $sp, 4\n"
+"\tsw $ra, 4($sp)\n"
+"\tlw $t6, __HEAPSTART\n"
+"\tlw $t7, __HEAPNEXT\n"
+"\taddi $t0, $t7, -4\t# the last word a block can start at\n"
+"\tjal __BlockBit\n"
+"\tla $t0, __BLOCKMAP\n"
+"__cunmap:\tsb $zero, ($t0)\n"
+"\taddi $t0, 1\n"
+"\tbleu $t0, $t3, __cunmap\n"
+"__cmap:\tbgeu $t6, $t7, __cmapped\n"
+"\taddi $t0, $t6, 4\n"
+"\tjal __BlockBit\n"
+"\tlbu $t0, ($t3)\n"
+"\tor $t0, $t0, $t2\n"
+"\tsb $t0, ($t3)\n"
+"\tlw $t0, ($t6)\n"
+"\tsrl $t0, $t0, 2\n"
+"\tsll $t0, $t0, 2\n"
+"\taddu $t6, $t6, $t0\n"
+"\taddi $t6, $t6, 4\t# next header\n"
+"\tb __cmap\n"
+"__cmapped:\tmove $t8, $sp\t\t# bottom of the work list\n"
+"\taddiu $t6, $sp, 4\n"
+"\tli $t7, 0x7ffffffc\n"
+"__cstack:\tbgtu $t6, $t7, __cglobs\t# roots on the stack\n"
+"\tlw $a0, ($t6)\n"
+"\tjal __GCMark\n"
+"\taddi $t6, 4\n"
+"\tb __cstack\n"
+"__cglobs:\tmove $t6, $gp\n"
+"\tlw $t7, __GLOBALBYTES\n"
+"\taddu $t7, $gp, $t7\n"
+"__cglob:\tbgeu $t6, $t7, __ctrace\t# roots among the globals\n"
+"\tlw $a0, ($t6)\n"
+"\tjal __GCMark\n"
+"\taddi $t6, 4\n"
+"\tb __cglob\n"
+"__ctrace:\tbeq $sp, $t8, __csweep\n"
+"\tlw $t6, 4($sp)\t\t# a marked block still to be scanned\n"
+"\taddu $sp, $sp, 4\n"
+"\tlw $t7, -4($t6)\n"
+"\tsrl $t7, $t7, 2\n"
+"\tsll $t7, $t7, 2\n"
+"\taddu $t7, $t6, $t7\n"
+"__cscan:\tbgeu $t6, $t7, __ctrace\n"
+"\tlw $a0, ($t6)\n"
+"\tjal __GCMark\n"
+"\taddi $t6, 4\n"
+"\tb __cscan\n"
+"__csweep:\tla $t0, __FREELISTS\n"
+"\taddi $t1, $t0, 132\n"
+"__cclear:\tsw $zero, ($t0)\n"
+"\taddi $t0, 4\n"
+"\tbltu $t0, $t1, __cclear\n"
+"\tsw $zero, __LARGEFREE\n"
+"\tlw $t6, __HEAPSTART\t# header of the current block\n"
+"\tlw $t7, __HEAPNEXT\n"
+"\tli $t8, 0\t\t# header of the free block being built\n"
+"__csloop:\tbgeu $t6, $t7, __csend\n"
+"\tlw $t0, ($t6)\n"
+"\tsrl $t1, $t0, 2\n"
+"\tsll $t1, $t1, 2\t\t# size\n"
+"\taddu $t9, $t6, $t1\n"
+"\taddi $t9, $t9, 4\t# next header\n"
+"\tandi $t2, $t0, 1\n"
+"\tbeqz $t2, __csfree\n"
+"\tsw $t1, ($t6)\t\t# live: clear the mark\n"
+"\tjal __GCRelease\n"
+"\tli $t8, 0\n"
+"\tb __csnext\n"
+"__csfree:\tbnez $t8, __csmerge\n"
+"\tori $t1, $t1, 2\n"
+"\tsw $t1, ($t6)\n"
+"\tmove $t8, $t6\n"
+"\tb __csnext\n"
+"__csmerge:\tlw $t2, ($t8)\t\t# grow the free block over this one\n"
+"\taddu $t2, $t2, $t1\n"
+"\taddi $t2, $t2, 4\n"
+"\tsw $t2, ($t8)\n"
+"__csnext:\tmove $t6, $t9\n"
+"\tb __csloop\n"
+"__csend:\tjal __GCRelease\n"
+"\tlw $t0, __HEAPNEXT\n"
+"\tsw $t0, __LASTNEXT\n"
+"\tsw $zero, __REUSED\n"
+"\tlw $ra, 4($sp)\n"
+"\taddu $sp, $sp, 4\n"
+"\tjr $ra\n"},
+
+  {"__GCMark", false, "__HEAPSTART __HEAPNEXT __BLOCKMAP",
+"__GCMark:\t\t\t# marks the block $a0 points into, if any\n"
+"\tlw $t0, __HEAPSTART\n"
+"\tbltu $a0, $t0, __gmdone\n"
+"\tlw $t1, __HEAPNEXT\n"
+"\tbgeu $a0, $t1, __gmdone\n"
+"\tandi $t1, $a0, 3\n"
+"\tbnez $t1, __gmdone\n"
+"\tsubu $t1, $a0, $t0\n"
+"\tsrl $t1, $t1, 2\t\t# word index in the heap\n"
+"\tla $t2, __BLOCKMAP\n"
+"__gmfind:\tsrl $t3, $t1, 3\t\t# back up to the nearest block start\n"
+"\taddu $t3, $t2, $t3\n"
+"\tlbu $t3, ($t3)\n"
+"\tandi $t4, $t1, 7\n"
+"\tsrlv $t3, $t3, $t4\n"
+"\tandi $t3, $t3, 1\n"
+"\tbnez $t3, __gmfound\n"
+"\tbeqz $t1, __gmdone\n"
+"\taddi $t1, -1\n"
+"\tb __gmfind\n"
+"__gmfound:\tsll $t1, $t1, 2\n"
+"\taddu $t1, $t0, $t1\n"
+"\tlw $t2, -4($t1)\n"
+"\tandi $t3, $t2, 3\n"
+"\tbnez $t3, __gmdone\t# already marked, or free\n"
+"\taddu $t3, $t1, $t2\n"
+"\tbgeu $a0, $t3, __gmdone\t# past the end of that block\n"
+"\tori $t2, $t2, 1\n"
+"\tsw $t2, -4($t1)\n"
+"\tsubu $sp, $sp, 4\n"
+"\tsw $t1, 4($sp)\t\t# its words get scanned later\n"
+"__gmdone:\tjr $ra\n"},
+
+  {"__BlockBit", false, "__HEAPSTART __BLOCKMAP",
+"__BlockBit:\t\t\t# finds the bit in __BLOCKMAP for the block at $t0:\n"
+"\tlw $t1, __HEAPSTART\t# its byte goes in $t3, the mask in $t2\n"
+"\tsubu $t0, $t0, $t1\n"
+"\tsrl $t0, $t0, 2\t\t# word index in the heap\n"
+"\tsrl $t1, $t0, 3\n"
+"\tla $t3, __BLOCKMAP\n"
+"\taddu $t3, $t3, $t1\n"
+"\tandi $t0, $t0, 7\n"
+"\tli $t2, 1\n"
+"\tsllv $t2, $t2, $t0\n"
+"\tjr $ra\n"},
+
+  {"__GCRelease", false, "__FREELISTS __LARGEFREE",
+"__GCRelease:\t\t\t# puts the free block with header $t8 on its list\n"
+"\tbeqz $t8, __grdone\n"
+"\tlw $t0, ($t8)\n"
+"\tsrl $t0, $t0, 2\t\t# size in words\n"
+"\tbeqz $t0, __grdone\n"
+"\taddi $t1, $t8, 4\n"
+"\tla $t2, __LARGEFREE\n"
+"\tbgt $t0, 32, __grlink\n"
+"\tla $t2, __FREELISTS\n"
+"\tsll $t0, $t0, 2\n"
+"\taddu $t2, $t2, $t0\n"
+"__grlink:\tlw $t3, ($t2)\n"
+"\tsw $t3, ($t1)\n"
+"\tsw $t1, ($t2)\n"
+"__grdone:\tjr $ra\n"},
+
+  {"_StringEqual", false, "",
+"_StringEqual:\n"
+"\tsubu $sp, $sp, 8      # decrement sp to make space to save ra, fp\n"
+"\tsw $fp, 8($sp)        # save fp\n"
+"\tsw $ra, 4($sp)        # save ra\n"
+"\taddiu $fp, $sp, 8     # set up new fp\n"
+"\n"
+"\tlw $t0, 4($fp)\n"
+"\tlw $t1, 8($fp)\n"
+"\tli $v0, 1\n"
+"\tbeq $t0, $t1, __end1     # the very same string\n"
+"\tli $v0, 0\n"
+"\tlw $t3, -4($t0)        # lengths are in the word before the text\n"
+"\tlw $t4, -4($t1)\n"
+"\tbne $t3, $t4, __end1\n"
+"\n"
+"\tsrl $t4, $t3, 2        # compare whole words first\n"
+"__bloop3:\n"
+"\tbeqz $t4, __eloop3\n"
+"\tlw $t5, ($t0)\n"
+"\tlw $t6, ($t1)\n"
+"\tbne $t5, $t6, __end1\n"
+"\taddi $t0, 4\n"
+"\taddi $t1, 4\n"
+"\taddi $t4, -1\n"
+"\tb __bloop3\n"
+"__eloop3:\n"
+"\tandi $t4, $t3, 3       # then the bytes left over\n"
+"__bloop4:\n"
+"\tbeqz $t4, __eloop4\n"
+"\tlb $t5, ($t0)\n"
+"\tlb $t6, ($t1)\n"
+"\tbne $t5, $t6, __end1\n"
+"\taddi $t0, 1\n"
+"\taddi $t1, 1\n"
+"\taddi $t4, -1\n"
+"\tb __bloop4\n"
+"__eloop4:\tli $v0,1\n"
+"\n"
+"__end1:\tmove $sp, $fp         # pop callee frame off stack\n"
+"\tlw $ra, -4($fp)       # restore saved ra\n"
+"\tlw $fp, 0($fp)        # restore saved fp\n"
+"\tjr $ra                # return from function\n"},
+
+  {"_Halt", false, "__FlushOutput",
+"_Halt:\n"
+"\tjal __FlushOutput\n"
+"\tli $v0, 10\n"
+"\tsyscall\n"},
+
+  {"__NullError", false, "__FlushOutput __NULLERR",
+"__NullError:\n"
+"\tjal __FlushOutput\t# reached by branch from a failed null check\n"
+"\tla   $a0, __NULLERR\n"
+"\tli   $v0, 4\n"
+"\tsyscall\n"
+"\tli   $v0, 10\n"
+"\tsyscall\n"},
+
+  {"_ReadInteger", false, "__FlushOutput",
+"_ReadInteger:\n"
+"\tsubu $sp, $sp, 8      # decrement sp to make space to save ra, fp\n"
+"\tsw $fp, 8($sp)        # save fp\n"
+"\tsw $ra, 4($sp)        # save ra\n"
+"\taddiu $fp, $sp, 8     # set up new fp\n"
+"\tsubu $sp, $sp, 4      # decrement sp to make space for locals/temps\n"
+"\tjal __FlushOutput\t# show pending output before waiting for input\n"
+"\tli $v0, 5\n"
+"\tsyscall\n"
+"\tmove $sp, $fp         # pop callee frame off stack\n"
+"\tlw $ra, -4($fp)       # restore saved ra\n"
+"\tlw $fp, 0($fp)        # restore saved fp\n"
+"\tjr $ra\n"},
+
+  {"_ReadLine", false, "__FlushOutput __SPACE",
+"_ReadLine:\n"
+"\tsubu $sp, $sp, 8      # decrement sp to make space to save ra, fp\n"
+"\tsw $fp, 8($sp)        # save fp\n"
+"\tsw $ra, 4($sp)        # save ra\n"
+"\taddiu $fp, $sp, 8     # set up new fp\n"
+"\tsubu $sp, $sp, 4      # decrement sp to make space for locals/temps\n"
+"\tjal __FlushOutput\t# show pending output before waiting for input\n"
+"\tli $a1, 40\n"
+"\tla $a0, __SPACE\n"
+"\tli $v0, 8\n"
+"\tsyscall\n"
+"\n"
+"\tla $t1, __SPACE\n"
+"__bloop5:\n"
+"\tlb $t5, ($t1)\n"
+"\tbeqz $t5, __eloop5\n"
+"\taddi $t1, 1\n"
+"\tb __bloop5\n"
+"__eloop5:\n"
+"\tlb $t5, -1($t1)\n"
+"\tbne $t5, 10, __rlkeep\t# drop the newline, if there is one\n"
+"\taddi $t1,-1\n"
+"\tsb $zero, ($t1)\n"
+"__rlkeep:\n"
+"\tla $v0, __SPACE\n"
+"\tsubu $t1, $t1, $v0\n"
+"\tsw $t1, -4($v0)\t\t# store the length before the text\n"
+"\tmove $sp, $fp         # pop callee frame off stack\n"
+"\tlw $ra, -4($fp)       # restore saved ra\n"
+"\tlw $fp, 0($fp)        # restore saved fp\n"
+"\tjr $ra\n"},
+
+  {"__TRUE", true, "", "__TRUE:.asciiz \"true\"\n"},
+  {"__FALSE", true, "", "__FALSE:.asciiz \"false\"\n"},
+  {"__SPACE", true, "", "\t.align 2\n\t.word 0\t\t# length of the line in __SPACE\n__SPACE:\t.space 40\n"},
+  {"__OUTPOS", true, "", "\t.align 2\n__OUTPOS:\t.word 0\t\t# number of characters in __OUTBUF\n"},
+  {"__OUTBUF", true, "", "__OUTBUF:\t.space 1025\t# 1024 characters and a terminator\n"},
+  {"__FREELISTS", true, "", "\t.align 2\n__FREELISTS:\t.space 132\t# list heads for blocks of 1 to 32 words\n"},
+  {"__LARGEFREE", true, "", "\t.align 2\n__LARGEFREE:\t.word 0\n"},
+  {"__HEAPSTART", true, "", "\t.align 2\n__HEAPSTART:\t.word 0\n"},
+  {"__HEAPNEXT", true, "", "\t.align 2\n__HEAPNEXT:\t.word 0\t# where the next new block goes\n"},
+  {"__HEAPEND", true, "", "\t.align 2\n__HEAPEND:\t.word 0\n"},
+  {"__LASTNEXT", true, "", "\t.align 2\n__LASTNEXT:\t.word 0\t# __HEAPNEXT as the last collection left it\n"},
+  {"__REUSED", true, "", "\t.align 2\n__REUSED:\t.word 0\t\t# bytes reused since the last collection\n"},
+  {"__GCOFF", true, "", "\t.align 2\n__GCOFF:\t.word 0\t\t# set once the heap can't be collected\n"},
+  {"__GLOBALBYTES", true, "", "\t.align 2\n__GLOBALBYTES:\t.word %d\t# size of the global variables\n"},
+  {"__BLOCKMAP", true, "", "__BLOCKMAP:\t.space 131072\n"},
+  {"__NULLERR", true, "",
+   "__NULLERR:.asciiz \"Decaf runtime error: Null object dereferenced\\n\"\n"}};
+
+static const int NumPieces = sizeof(pieces) / sizeof(pieces[0]);
+
+
+static int PieceForLabel(const string &label)
+{
+  for (int i = 0; i < NumPieces; i++)
+    if (label == pieces[i].label) return i;
+  return -1;
+}
+
+
+/* Method: Require
+ * ---------------
+ * Adds the piece named by label and, transitively, everything it uses.
+ */
+void Runtime::Require(const char *label)
+{
+  int index = PieceForLabel(label);
+  if (index == -1 || !required.insert(label).second) return;
+
+  const char *uses = pieces[index].uses;
+  while (*uses) {
+    int len = strcspn(uses, " ");
+    Require(string(uses, len).c_str());
+    uses += len + strspn(uses + len, " ");
+  }
+}
+
+
+void Runtime::SetGlobalBytes(int numBytes)
+{
+  globalBytes = numBytes;
+}
+
+
+void Runtime::RequireFlushAtExit()
+{
+  flushAtExit = true;
+}
+
+
+/* Method: Emit
+ * ------------
+ * Pieces come out in the order of the table rather than the order
+ * they were required, which keeps the output stable. Data pieces are
+ * printed as formats, so __GLOBALBYTES can take its value.
+ */
+void Runtime::Emit()
+{
+  if (required.empty() && !flushAtExit) return;
+  printf("\n\t# Decaf run-time library\n\t.text\n");
+  if (flushAtExit && !required.count("__FlushOutput"))
+    printf("__FlushOutput:\n\tjr $ra\t\t\t# nothing is ever printed\n\n");
+  for (int i = 0; i < NumPieces; i++)
+    if (!pieces[i].isData && required.count(pieces[i].label))
+      printf("%s\n", pieces[i].text);
+
+  bool inData = false;
+  for (int i = 0; i < NumPieces; i++)
+    if (pieces[i].isData && required.count(pieces[i].label)) {
+      if (!inData) printf("\t.data\n");
+      inData = true;
+      printf(pieces[i].text, globalBytes);
+    }
+}
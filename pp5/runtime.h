@@ -0,0 +1,62 @@
+/* File: runtime.h
+ * ---------------
+ * The Decaf run-time library: the built-in functions (see the BuiltIn
+ * enum in codegen.h) and the helper routines the generated code jumps
+ * to, along with the data they use. The compiler appends to each
+ * program only the pieces it actually refers to, so the assembly it
+ * writes is complete in itself and nothing needs to be tacked on
+ * before running it through spim.
+ *
+ * The built-ins have the labels the front end calls them by. Everything
+ * else here, down to the labels inside each routine, starts with "__",
+ * which no label the compiler makes for the program can: functions are
+ * "_" followed by the name and classes are the name, and names start
+ * with a letter.
+ *
+ * Output is buffered: the print built-ins append their text to
+ * __OUTBUF, which goes out with one syscall when it fills up, before
+ * the program waits for input and before it stops (_Halt, a run-time
+ * error or the return from main).
+ *
+ * Memory from _Alloc is garbage collected: when the heap fills up, a
+ * mark-sweep collector finds the blocks still reachable from the stack
+ * and the global variables and recycles the rest.
+ */
+
+#ifndef _H_runtime
+#define _H_runtime
+
+#include <set>
+#include <string>
+
+
+class Runtime {
+  protected:
+    std::set<std::string> required;
+    bool flushAtExit;
+    int globalBytes;
+
+  public:
+    Runtime() : flushAtExit(false), globalBytes(0) {}
+
+         // Notes that the program refers to label. Labels that do not
+         // belong to the run-time library are ignored, so every call
+         // target can simply be passed along.
+    void Require(const char *label);
+
+         // Notes that the program calls __FlushOutput on its way out
+         // of main. If nothing else requires the real routine (there
+         // is no printing), an empty one is emitted instead.
+    void RequireFlushAtExit();
+
+         // Tells the collector how many bytes of global variables
+         // start at $gp, all of which it treats as roots.
+    void SetGlobalBytes(int numBytes);
+
+         // Emits the text of each required routine, then the data
+         // segment holding what they use. Whatever a routine in turn
+         // depends on is included as well.
+    void Emit();
+};
+
+#endif
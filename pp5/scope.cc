@@ -13,17 +13,35 @@
 Scope::Scope()
 {
     table = new Hashtable<Decl*>;
+    flattened = NULL;
+    chainedLookups = 0;
 }
 
 
 /* Method: Lookup
  * --------------
- * Looks for an identifier in this scope only. Returns NULL if
- * not found.
+ * Looks for an identifier in this scope only (including what it
+ * inherits, see AddInherited). Returns NULL if not found.
  */
 Decl *Scope::Lookup(Identifier *id)       
 {
-    return table->Lookup(id->GetName());
+    return Lookup(id->GetSymbol());
+}
+
+Decl *Scope::Lookup(Symbol name)
+{
+    if (flattened) return flattened->Lookup(name);
+    Decl *decl = table->Lookup(name);
+    if (decl || inherited.empty()) return decl;
+
+    if (++chainedLookups > FlattenAfter) {
+        flattened = new Hashtable<Decl*>;
+        FlattenInto(flattened);
+        return flattened->Lookup(name);
+    }
+    for (int i = 0; i < inherited.size(); i++)
+        if ((decl = inherited[i]->Lookup(name)) != NULL) return decl;
+    return NULL;
 }
 
 
@@ -35,20 +53,50 @@ Decl *Scope::Lookup(Identifier *id)
  */
 bool Scope::Declare(Decl *decl)
 {
-  Decl *prev = table->Lookup(decl->GetName());
+  Decl *prev = table->Lookup(decl->GetSymbol());
   //PrintDebug("scope", "Line %d declaring %s (prev? %p)\n", decl->GetLocation()->first_line, decl->GetName(), prev);
   //if (prev && decl->ConflictsWithPrevious(prev)) // throw away second, keep first
   //    return false;
-  table->Enter(decl->GetName(), decl);
+  table->Enter(decl->GetSymbol(), decl);
+  if (flattened) flattened->Enter(decl->GetSymbol(), decl);
   return true;
 }
 
-void Scope::CopyFromScope(Scope *other, ClassDecl *addTo)
+void Scope::AddInherited(Scope *other)
 {
-    Iterator<Decl*> iter = other->table->GetIterator();
+    inherited.push_back(other);
+    delete flattened;
+    flattened = NULL;
+    chainedLookups = 0;
+}
+
+
+/* Method: FlattenInto
+ * -------------------
+ * Enters every name visible in this scope into the given table, the
+ * lowest priority ones first so that each name ends up with the Decl
+ * Lookup would find.
+ */
+void Scope::FlattenInto(Hashtable<Decl*> *into)
+{
+    for (int i = inherited.size() - 1; i >= 0; i--)
+        inherited[i]->FlattenInto(into);
+    Iterator<Decl*> iter = table->GetIterator();
     Decl *decl;
     while ((decl = iter.GetNextValue()) != NULL) {
-        table->Enter(decl->GetName(), decl);
+        into->Enter(decl->GetSymbol(), decl);
     }
 }
 
+
+/* Method: ScopeStack::Lookup
+ * --------------------------
+ */
+Decl *ScopeStack::Lookup(Identifier *id)
+{
+    for (int i = scopes.size() - 1; i >= 0; i--) {
+        Decl *decl = scopes[i]->Lookup(id);
+        if (decl) return decl;
+    }
+    return NULL;
+}
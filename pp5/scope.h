@@ -2,12 +2,20 @@
  * -------------
  * The Scope class will be used to manage scopes, sort of
  * table used to map identifier names to Declaration objects.
+ *
+ * A class scope does not copy what it inherits. It holds its own
+ * members and links to the scopes of its parent class and of the
+ * interfaces it implements, which Lookup searches in that order when
+ * the name is not one of its own. A scope whose lookups keep falling
+ * through to the chain builds a flattened table of the whole chain
+ * once and answers from that from then on.
  */
 
 #ifndef _H_scope
 #define _H_scope
 
 #include "hashtable.h"
+#include <vector>
 
 class Decl;
 class Identifier;
@@ -16,13 +24,43 @@ class ClassDecl;
 class Scope { 
   protected:
     Hashtable<Decl*> *table;
+    std::vector<Scope*> inherited;   // searched in order after table
+    Hashtable<Decl*> *flattened;     // table plus inherited, once hot
+    int chainedLookups;
+
+    static const int FlattenAfter = 8;
+
+    Decl *Lookup(Symbol name);
+    void FlattenInto(Hashtable<Decl*> *into);
 
   public:
     Scope();
 
     Decl *Lookup(Identifier *id);
     bool Declare(Decl *dec);
-    void CopyFromScope(Scope *other, ClassDecl *cd);
+
+         // Makes the names in other visible in this scope, behind this
+         // scope's own names and those of scopes added before it. other
+         // is linked rather than copied, so it should be complete by the
+         // time this scope is looked in.
+    void AddInherited(Scope *other);
+};
+
+
+/* The ScopeStack holds the scopes open at some point of a walk over
+ * the tree, innermost on top, so a name can be looked up without
+ * climbing the tree from the node where it is used.
+ */
+class ScopeStack {
+  protected:
+    std::vector<Scope*> scopes;
+
+  public:
+    void Push(Scope *s)   { scopes.push_back(s); }
+    void Pop()            { scopes.pop_back(); }
+
+         // Returns the innermost declaration of id or NULL.
+    Decl *Lookup(Identifier *id);
 };
 
 
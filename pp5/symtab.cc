@@ -0,0 +1,94 @@
+/* File: symtab.cc
+ * ---------------
+ * Implementation of the SymbolTable class. Names are found through an
+ * open-addressing hash table with linear probing, holding Symbols and
+ * kept at most half full; the spellings and their hash codes live in
+ * arrays indexed by Symbol. Locations are created (and their names
+ * interned) during static initialization, so the table is built on
+ * first use rather than being a static object itself.
+ */
+
+#include "symtab.h"
+#include "utility.h"
+#include "arena.h"
+#include <string.h>
+#include <vector>
+
+struct _table {
+  std::vector<const char *> names;
+  std::vector<unsigned> hashes;
+  std::vector<Symbol> buckets;             // -1 marks an empty bucket
+};
+
+static struct _table &TheTable()
+{
+  static struct _table *table = new _table;
+  return *table;
+}
+
+
+static unsigned HashText(const char *text, int length)
+{
+  unsigned h = 2166136261u;                 // FNV-1a
+  for (int i = 0; i < length; i++)
+    h = (h ^ (unsigned char)text[i]) * 16777619u;
+  return h;
+}
+
+
+/* Function: Rehash
+ * ----------------
+ * Doubles the number of buckets (starting from 256) and puts each
+ * Symbol back in, using the hash code saved when it was interned.
+ */
+static void Rehash(struct _table &t)
+{
+  std::vector<Symbol> &buckets = t.buckets;
+  buckets.assign(buckets.empty() ? 256 : 2 * buckets.size(), -1);
+  unsigned mask = buckets.size() - 1;
+  for (Symbol s = 0; s < t.names.size(); s++) {
+    unsigned b = t.hashes[s] & mask;
+    while (buckets[b] != -1) b = (b + 1) & mask;
+    buckets[b] = s;
+  }
+}
+
+
+Symbol SymbolTable::Intern(const char *text, int length)
+{
+  Assert(text != NULL && length >= 0);
+  struct _table &t = TheTable();
+  if (2 * (t.names.size() + 1) > t.buckets.size()) Rehash(t);
+  unsigned h = HashText(text, length), mask = t.buckets.size() - 1;
+  unsigned b = h & mask;
+  for (; t.buckets[b] != -1; b = (b + 1) & mask) {
+    Symbol s = t.buckets[b];
+    if (t.hashes[s] == h && !strncmp(t.names[s], text, length) && t.names[s][length] == '\0')
+      return s;
+  }
+
+  char *name = (char *)Arena::Allocate(length + 1);
+  memcpy(name, text, length);
+  name[length] = '\0';
+  t.buckets[b] = t.names.size();
+  t.names.push_back(name);
+  t.hashes.push_back(h);
+  return t.buckets[b];
+}
+
+Symbol SymbolTable::Intern(const char *name)
+{
+  return Intern(name, strlen(name));
+}
+
+
+const char *SymbolTable::Name(Symbol sym)
+{
+  Assert(sym >= 0 && sym < TheTable().names.size());
+  return TheTable().names[sym];
+}
+
+int SymbolTable::NumSymbols()
+{
+  return TheTable().names.size();
+}
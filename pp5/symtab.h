@@ -0,0 +1,30 @@
+/* File: symtab.h
+ * --------------
+ * The symbol table interns names: each distinct spelling is stored
+ * once and identified by a small integer, its Symbol. The scanner
+ * interns every identifier it reads, and the rest of the compiler
+ * passes Symbols around, so two names are the same exactly when their
+ * Symbols are equal and no string comparison is ever needed.
+ * Symbols are numbered from 0 in the order they are first interned.
+ */
+
+#ifndef _H_symtab
+#define _H_symtab
+
+typedef int Symbol;
+
+class SymbolTable {
+  public:
+         // Returns the Symbol for the first length characters of text,
+         // adding it to the table if this is the first time it is seen.
+    static Symbol Intern(const char *text, int length);
+    static Symbol Intern(const char *name);
+
+         // Returns the spelling of sym. The string belongs to the table
+         // and is the same pointer every time.
+    static const char *Name(Symbol sym);
+
+    static int NumSymbols();
+};
+
+#endif
@@ -11,7 +11,7 @@
 using namespace std;
 
 Location::Location(Segment s, int o, const char *name) :
-  variableName(strdup(name)), segment(s), offset(o), base(NULL) {}
+  variableName(SymbolTable::Intern(name)), segment(s), offset(o), base(NULL) {}
 
  
 void Instruction::Print() {
@@ -69,8 +69,8 @@ void Assign::EmitSpecific(Mips *mips) {
 }
 
 
-Load::Load(Location *d, Location *s, int off)
-  : dst(d), src(s), offset(off) {
+Load::Load(Location *d, Location *s, int off, const char *ac)
+  : dst(d), src(s), offset(off), aliasClass(ac) {
   Assert(dst != NULL && src != NULL);
   if (offset) 
     sprintf(printed, "%s = *(%s + %d)", dst->GetName(), src->GetName(), offset);
@@ -82,8 +82,8 @@ void Load::EmitSpecific(Mips *mips) {
 }
 
 
-Store::Store(Location *d, Location *s, int off)
-  : dst(d), src(s), offset(off) {
+Store::Store(Location *d, Location *s, int off, const char *ac)
+  : dst(d), src(s), offset(off), aliasClass(ac) {
   Assert(dst != NULL && src != NULL);
   if (offset)
     sprintf(printed, "*(%s + %d) = %s", dst->GetName(), offset, src->GetName());
@@ -208,15 +208,79 @@ void ACall::EmitSpecific(Mips *mips) {
 VTable::VTable(const char *l, List<const char *> *m)
   : methodLabels(m), label(strdup(l)) {
   Assert(methodLabels != NULL && label != NULL);
+  selectors = new List<const char *>;
+  selectorMethods = new List<const char *>;
   sprintf(printed, "VTable for class %s", l);
 }
 
+void VTable::AddSelector(const char *selector, const char *methodLabel) {
+  selectors->Append(strdup(selector));
+  selectorMethods->Append(strdup(methodLabel));
+  slots.push_back(-1);
+}
+
 void VTable::Print() {
   printf("VTable %s =\n", label);
   for (int i = 0; i < methodLabels->NumElements(); i++) 
     printf("\t%s,\n", methodLabels->Nth(i));
+  for (int i = 0; i < selectors->NumElements(); i++)
+    printf("\t%s: %s,\n", selectors->Nth(i), selectorMethods->Nth(i));
   printf("; \n"); 
 }
 void VTable::EmitSpecific(Mips *mips) {
-  mips->EmitVTable(label, methodLabels);
+  std::vector<const char *> slotMethods;      // indexed by slot, NULL if unused
+  for (int i = 0; i < selectors->NumElements(); i++) {
+    Assert(slots[i] >= 0);
+    if (slotMethods.size() <= slots[i]) slotMethods.resize(slots[i] + 1, NULL);
+    slotMethods[slots[i]] = selectorMethods->Nth(i);
+  }
+  mips->EmitVTable(label, methodLabels, slotMethods);
+}
+
+LoadSelector::LoadSelector(Location *d, Location *vt, const char *s)
+  : dst(d), vtable(vt), selector(strdup(s)), slot(-1) {
+  Assert(dst != NULL && vtable != NULL);
+  sprintf(printed, "%s = LoadSelector %s %s", dst->GetName(), vtable->GetName(), selector);
+}
+void LoadSelector::EmitSpecific(Mips *mips) {
+  Assert(slot >= 0);
+  mips->EmitLoadSelector(dst, vtable, slot);
+}
+
+NullCheck::NullCheck(Location *r)
+  : ref(r) {
+  Assert(ref != NULL);
+  sprintf(printed, "NullCheck %s", ref->GetName());
+}
+void NullCheck::EmitSpecific(Mips *mips) {
+  mips->EmitNullCheck(ref);
+}
+
+StackAlloc::StackAlloc(Location *d, int off, int nb)
+  : dst(d), offset(off), numBytes(nb) {
+  Assert(dst != NULL && numBytes > 0);
+  sprintf(printed, "%s = StackAlloc %d (fp%+d)", dst->GetName(), numBytes, offset);
+}
+void StackAlloc::EmitSpecific(Mips *mips) {
+  mips->EmitStackAlloc(dst, offset, numBytes);
+}
+
+FastCall::FastCall(const char *l, Location *d, Location *a, int s)
+  : label(strdup(l)), dst(d), arg(a), syscall(s) {
+  sprintf(printed, "%s%sFastCall %s%s%s", dst ? dst->GetName() : "", dst ? " = " : "",
+          label, arg ? " " : "", arg ? arg->GetName() : "");
+  if (syscall)
+    sprintf(printed + strlen(printed), "; Syscall %d", syscall);
+}
+void FastCall::EmitSpecific(Mips *mips) {
+  mips->EmitFastCall(label, dst, arg, syscall);
+}
+
+InlineAlloc::InlineAlloc(Location *d, int nb)
+  : dst(d), numBytes(nb) {
+  Assert(dst != NULL && numBytes > 0 && numBytes % 4 == 0);
+  sprintf(printed, "%s = InlineAlloc %d", dst->GetName(), numBytes);
+}
+void InlineAlloc::EmitSpecific(Mips *mips) {
+  mips->EmitInlineAlloc(dst, numBytes);
 }
@@ -24,6 +24,8 @@
 #define _H_tac
 
 #include "list.h" // for VTable
+#include "symtab.h"
+#include <vector>
 class Mips;
 
 
@@ -40,7 +42,7 @@ typedef enum {fpRelative, gpRelative} Segment;
 class Location
 {
   protected:
-    const char *variableName;
+    Symbol variableName;
     Segment segment;
     int offset;
     Location* base;
@@ -48,7 +50,8 @@ class Location
   public:
     Location(Segment seg, int offset, const char *name);
 
-    const char *GetName() const     { return variableName; }
+    const char *GetName() const     { return SymbolTable::Name(variableName); }
+    Symbol GetSymbol() const        { return variableName; }
     Segment GetSegment() const      { return segment; }
     int GetOffset() const           { return offset; }
     Location* GetBase() const       { return base; }
@@ -67,6 +70,16 @@ class Instruction {
 	virtual void Print();
 	virtual void EmitSpecific(Mips *mips) = 0;
 	void Emit(Mips *mips);
+
+	// The text Print shows for the instruction (empty for a Label).
+	const char *GetPrinted() const { return printed; }
+
+	// Hooks used by the optimizer (see optimizer.h). GetDst returns
+	// the location the instruction writes (NULL if none) and GetSrcs
+	// fills in the locations it reads, returning how many there are.
+	static const int MaxSrcs = 2;
+	virtual Location *GetDst() { return NULL; }
+	virtual int GetSrcs(Location *srcs[MaxSrcs]) { return 0; }
 };
 
   
@@ -92,6 +105,11 @@ class Instruction {
   class LCall;
   class ACall;
   class VTable;
+  class LoadSelector;
+  class NullCheck;
+  class StackAlloc;
+  class FastCall;
+  class InlineAlloc;
 
 
 
@@ -101,6 +119,8 @@ class LoadConstant: public Instruction {
   public:
     LoadConstant(Location *dst, int val);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    int GetValue() const { return val; }
 };
 
 class LoadStringConstant: public Instruction {
@@ -109,6 +129,7 @@ class LoadStringConstant: public Instruction {
   public:
     LoadStringConstant(Location *dst, const char *s);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
 };
     
 class LoadLabel: public Instruction {
@@ -117,6 +138,8 @@ class LoadLabel: public Instruction {
   public:
     LoadLabel(Location *dst, const char *label);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    const char *GetLabel() const { return label; }
 };
 
 class Assign: public Instruction {
@@ -124,22 +147,42 @@ class Assign: public Instruction {
   public:
     Assign(Location *dst, Location *src);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    Location *GetSrc() { return src; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = src; return 1; }
 };
 
+  // Load and Store take an optional alias class naming the static type
+  // of the memory they touch: the class that declares a field, or the
+  // array type for an element (e.g. "int[]"). Accesses with different
+  // alias classes never overlap; NULL means the class is unknown.
+  
 class Load: public Instruction {
     Location *dst, *src;
     int offset;
+    const char *aliasClass;
   public:
-    Load(Location *dst, Location *src, int offset = 0);
+    Load(Location *dst, Location *src, int offset = 0, const char *aliasClass = NULL);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    Location *GetReference() { return src; }
+    int GetOffset() const { return offset; }
+    const char *GetAliasClass() const { return aliasClass; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = src; return 1; }
 };
 
 class Store: public Instruction {
     Location *dst, *src;
     int offset;
+    const char *aliasClass;
   public:
-    Store(Location *d, Location *s, int offset = 0);
+    Store(Location *d, Location *s, int offset = 0, const char *aliasClass = NULL);
     void EmitSpecific(Mips *mips);
+    Location *GetReference() { return dst; }
+    Location *GetValue() { return src; }
+    int GetOffset() const { return offset; }
+    const char *GetAliasClass() const { return aliasClass; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = dst; srcs[1] = src; return 2; }
 };
 
 class BinaryOp: public Instruction {
@@ -155,6 +198,11 @@ class BinaryOp: public Instruction {
   public:
     BinaryOp(OpCode c, Location *dst, Location *op1, Location *op2);
     void EmitSpecific(Mips *mips);
+    OpCode GetOpCode() const { return code; }
+    Location *GetDst() { return dst; }
+    Location *GetOp1() { return op1; }
+    Location *GetOp2() { return op2; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = op1; srcs[1] = op2; return 2; }
 };
 
 class Label: public Instruction {
@@ -181,6 +229,8 @@ class IfZ: public Instruction {
     IfZ(Location *test, const char *label);
     void EmitSpecific(Mips *mips);
     const char* branch_label() const { return label; }
+    Location *GetTest() { return test; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = test; return 1; }
 };
 
 class BeginFunc: public Instruction {
@@ -189,6 +239,7 @@ class BeginFunc: public Instruction {
     BeginFunc();
     // used to backpatch the instruction with frame size once known
     void SetFrameSize(int numBytesForAllLocalsAndTemps);
+    int GetFrameSize() const { return frameSize; }
     void EmitSpecific(Mips *mips);
 };
 
@@ -203,6 +254,8 @@ class Return: public Instruction {
   public:
     Return(Location *val);
     void EmitSpecific(Mips *mips);
+    Location *GetValue() { return val; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = val; return val ? 1 : 0; }
 };   
 
 class PushParam: public Instruction {
@@ -210,6 +263,8 @@ class PushParam: public Instruction {
   public:
     PushParam(Location *param);
     void EmitSpecific(Mips *mips);
+    Location *GetParam() { return param; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = param; return 1; }
 }; 
 
 class PopParams: public Instruction {
@@ -217,6 +272,7 @@ class PopParams: public Instruction {
   public:
     PopParams(int numBytesOfParamsToRemove);
     void EmitSpecific(Mips *mips);
+    int GetNumBytes() const { return numBytes; }
 }; 
 
 class LCall: public Instruction {
@@ -225,6 +281,8 @@ class LCall: public Instruction {
   public:
     LCall(const char *labe, Location *result);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    const char *GetLabel() const { return label; }
 };
 
 class ACall: public Instruction {
@@ -232,15 +290,111 @@ class ACall: public Instruction {
   public:
     ACall(Location *meth, Location *result);
     void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    Location *GetMethodAddr() { return methodAddr; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = methodAddr; return 1; }
 };
 
+  // Besides its class methods, a VTable holds the methods the class
+  // provides for the interfaces it implements, each added under its
+  // selector: the interface name and method name joined by a dot, as
+  // in "Shape.Area". Interface methods sit at negative offsets from the
+  // vtable label, in the slot each selector is assigned program-wide
+  // (see dispatch.cc).
 class VTable: public Instruction {
     List<const char *> *methodLabels;
     const char *label;
+    List<const char *> *selectors, *selectorMethods;
+    std::vector<int> slots;
  public:
     VTable(const char *labelForTable, List<const char *> *methodLabels);
+    void AddSelector(const char *selector, const char *methodLabel);
+    void SetSlot(int index, int slot) { slots[index] = slot; }
+    int GetSlot(int index) const { return slots[index]; }
     void Print();
     void EmitSpecific(Mips *mips);
+    const char *GetLabel() const { return label; }
+    List<const char *> *GetMethodLabels() { return methodLabels; }
+    List<const char *> *GetSelectors() { return selectors; }
+    List<const char *> *GetSelectorMethods() { return selectorMethods; }
+};
+
+  // LoadSelector reads the address of the method implementing an
+  // interface selector out of the vtable in vtable, for an ACall. It
+  // costs the same single load as a class method lookup once the
+  // selector has been given its slot.
+class LoadSelector: public Instruction {
+    Location *dst, *vtable;
+    const char *selector;
+    int slot;
+  public:
+    LoadSelector(Location *dst, Location *vtable, const char *selector);
+    void EmitSpecific(Mips *mips);
+    const char *GetSelector() const { return selector; }
+    void SetSlot(int s) { slot = s; }
+    int GetSlot() const { return slot; }
+    Location *GetDst() { return dst; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = vtable; return 1; }
+};
+
+
+class NullCheck: public Instruction {
+    Location *ref;
+  public:
+    NullCheck(Location *ref);
+    void EmitSpecific(Mips *mips);
+    Location *GetReference() { return ref; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = ref; return 1; }
+};
+
+
+  // StackAlloc is not generated by the front end. The optimizer uses it
+  // in place of a call to _Alloc for an object that never escapes the
+  // function creating it: numBytes of the function's own stack frame,
+  // starting at the given fp offset, are zero filled and their address
+  // is put in dst.
+class StackAlloc: public Instruction {
+    Location *dst;
+    int offset, numBytes;
+  public:
+    StackAlloc(Location *dst, int offset, int numBytes);
+    void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    int GetNumBytes() const { return numBytes; }
+};
+
+
+  // FastCall is also introduced by the optimizer, in place of a call
+  // to a built-in whose run-time routine has an internal entry point
+  // that takes its argument in $a0 and returns its result in $v0 (see
+  // fastcall.cc). The routine may push a frame of its own and make calls
+  // of its own (__Malloc can run the collector), and it uses the $t
+  // registers freely, so callers must not keep values in them across
+  // the call. An optional syscall follows the call (for halt).
+class FastCall: public Instruction {
+    const char *label;
+    Location *dst, *arg;
+    int syscall;
+  public:
+    FastCall(const char *label, Location *dst, Location *arg, int syscall = 0);
+    void EmitSpecific(Mips *mips);
+    const char *GetLabel() const { return label; }
+    Location *GetDst() { return dst; }
+    int GetSrcs(Location *srcs[MaxSrcs]) { srcs[0] = arg; return arg ? 1 : 0; }
+};
+
+
+  // InlineAlloc replaces a call to _Alloc whose size is known at compile
+  // time. It carves numBytes off the end of the heap right where it is,
+  // and only calls the run-time library when the heap needs to grow.
+class InlineAlloc: public Instruction {
+    Location *dst;
+    int numBytes;
+  public:
+    InlineAlloc(Location *dst, int numBytes);
+    void EmitSpecific(Mips *mips);
+    Location *GetDst() { return dst; }
+    int GetNumBytes() const { return numBytes; }
 };
 
 
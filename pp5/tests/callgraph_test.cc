@@ -0,0 +1,106 @@
+/* File: callgraph_test.cc
+ * -----------------------
+ * Tests for dead function elimination (callgraph.cc).
+ */
+
+#include "check.h"
+#include "optimizer.h"
+
+static Location *t = Local("t", 0);
+
+
+    // Appends a function with the given label and body.
+static void AddFunction(std::list<Instruction*> &code, const char *label,
+                        Instruction *body1 = NULL, Instruction *body2 = NULL)
+{
+  code.push_back(new Label(label));
+  BeginFunc *begin = new BeginFunc;
+  begin->SetFrameSize(4);
+  code.push_back(begin);
+  if (body1) code.push_back(body1);
+  if (body2) code.push_back(body2);
+  code.push_back(new EndFunc);
+}
+
+static VTable *AddVTable(std::list<Instruction*> &code, const char *label,
+                         const char *method1, const char *method2 = NULL)
+{
+  List<const char *> *methods = new List<const char *>;
+  methods->Append(method1);
+  if (method2) methods->Append(method2);
+  VTable *vtable = new VTable(label, methods);
+  code.push_back(vtable);
+  return vtable;
+}
+
+    // The labels of the functions and vtables left in code
+static std::string Survivors(const std::list<Instruction*> &code)
+{
+  std::string result;
+  for (std::list<Instruction*>::const_iterator p = code.begin(); p != code.end(); ++p) {
+    const char *label = NULL;
+    if (Label *l = dynamic_cast<Label*>(*p)) label = l->text();
+    else if (VTable *vt = dynamic_cast<VTable*>(*p)) label = vt->GetLabel();
+    if (!label) continue;
+    if (!result.empty()) result += " ";
+    result += label;
+  }
+  return result;
+}
+
+
+static void TestCalls()
+{
+  std::list<Instruction*> code;
+  AddFunction(code, "_f", new LCall("_g", NULL));
+  AddFunction(code, "_g", new LCall("_g", NULL), new LCall("_PrintInt", NULL));
+  AddFunction(code, "_h", new LCall("_k", NULL));
+  AddFunction(code, "_k");
+  AddFunction(code, "_p");
+  AddFunction(code, "main", new LCall("_f", NULL), new LoadLabel(t, "_p"));
+  EliminateDeadFunctions(&code);
+  CHECK(Survivors(code) == "_f _g _p main");
+  CHECK(code.size() == 17);
+}
+
+    // A class's methods are kept when its vtable is, and its vtable
+    // is kept when reachable code makes an object of the class.
+static void TestClasses()
+{
+  std::list<Instruction*> code;
+  AddVTable(code, "A", "_A.m", "_B.n");
+  VTable *b = AddVTable(code, "B", "_B.m", "_B.n");
+  b->AddSelector("I.x", "_B.x");
+  VTable *c = AddVTable(code, "C", "_C.m");
+  c->AddSelector("I.x", "_C.x");
+  AddFunction(code, "_A.m");
+  AddFunction(code, "_B.m");
+  AddFunction(code, "_B.n");
+  AddFunction(code, "_B.x");
+  AddFunction(code, "_C.m", new LoadLabel(t, "A"));
+  AddFunction(code, "_C.x");
+  AddFunction(code, "_f", new LoadLabel(t, "B"));
+  AddFunction(code, "main", new LoadLabel(t, "C"));
+  EliminateDeadFunctions(&code);
+  CHECK(Survivors(code) == "A C _A.m _B.n _C.m _C.x main");
+}
+
+    // Without main there is no telling what is used.
+static void TestNoMain()
+{
+  std::list<Instruction*> code;
+  AddVTable(code, "A", "_A.m");
+  AddFunction(code, "_A.m");
+  AddFunction(code, "_f");
+  EliminateDeadFunctions(&code);
+  CHECK(Survivors(code) == "A _A.m _f");
+}
+
+
+int main()
+{
+  TestCalls();
+  TestClasses();
+  TestNoMain();
+  return Failures();
+}
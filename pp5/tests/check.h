@@ -0,0 +1,102 @@
+/* File: check.h
+ * -------------
+ * What the optimizer tests share. The front end doesn't generate every
+ * instruction the passes work on yet, so a test writes the Tac of one
+ * function by hand in a TestFunction, runs a pass over its FlowGraph
+ * and compares the code that comes back, as a Listing, with what the
+ * pass should have made of it.
+ *
+ * CHECK and CHECK_CODE print what went wrong and carry on. Each test
+ * program returns Failures() from main, so make check stops at the
+ * first program with a failed check.
+ */
+
+#ifndef _H_check
+#define _H_check
+
+#include <cstdio>
+#include <cstring>
+#include <list>
+#include <string>
+#include "tac.h"
+#include "cfg.h"
+
+
+static int numFailures = 0;
+
+#define CHECK(cond) \
+  ((cond) ? (void)0 : Fail(__FILE__, __LINE__, #cond, NULL, NULL))
+
+#define CHECK_CODE(code, expected) \
+  (Listing(code) == (expected) ? (void)0 \
+       : Fail(__FILE__, __LINE__, #code, (expected), Listing(code).c_str()))
+
+static void Fail(const char *file, int line, const char *what,
+                 const char *expected, const char *actual)
+{
+  numFailures++;
+  printf("%s:%d: check failed: %s\n", file, line, what);
+  if (expected) printf("    expected: %s\n    actual:   %s\n", expected, actual);
+}
+
+static int Failures()
+{
+  return numFailures != 0;
+}
+
+
+    // The instructions of code, one after another with "; " between
+    // them, as Print shows them. A Label is its name and a colon.
+static std::string Listing(const std::list<Instruction*> &code)
+{
+  std::string result;
+  for (std::list<Instruction*>::const_iterator p = code.begin(); p != code.end(); ++p) {
+    if (p != code.begin()) result += "; ";
+    Label *label = dynamic_cast<Label*>(*p);
+    result += label ? std::string(label->text()) + ":" : (*p)->GetPrinted();
+  }
+  return result;
+}
+
+
+    // A function under test. Add the instructions of its body, then
+    // Graph builds the FlowGraph for them, and Code lays the graph out
+    // again once a pass has run over it. The BeginFunc and EndFunc are
+    // supplied, and left out of both.
+class TestFunction {
+  public:
+    BeginFunc *begin;
+    std::list<Instruction*> body;
+    FlowGraph *graph;
+
+    TestFunction(int frameSize = 64) : graph(NULL) {
+      begin = new BeginFunc;
+      begin->SetFrameSize(frameSize);
+    }
+
+    void Add(Instruction *instr) { body.push_back(instr); }
+    FlowGraph *Graph() {
+      graph = new FlowGraph(begin, body.begin(), body.end());
+      return graph;
+    }
+    std::list<Instruction*> Code() {
+      std::list<Instruction*> code;
+      graph->Linearize(&code);
+      return code;
+    }
+};
+
+
+    // Locals of the function under test, each in its own stack slot,
+    // and globals, each in its own slot of the global segment.
+static Location *Local(const char *name, int n)
+{
+  return new Location(fpRelative, -8 - 4 * n, name);
+}
+
+static Location *Global(const char *name, int n)
+{
+  return new Location(gpRelative, 4 * n, name);
+}
+
+#endif
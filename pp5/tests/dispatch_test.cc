@@ -0,0 +1,61 @@
+/* File: dispatch_test.cc
+ * ----------------------
+ * Tests for interface selector slot assignment (dispatch.cc).
+ */
+
+#include "check.h"
+#include "codegen.h"
+
+static Location *t = Local("t", 0), *vt = Local("vt", 1);
+
+
+static VTable *AddVTable(std::list<Instruction*> &code, const char *label,
+                         const char *selector1, const char *selector2 = NULL)
+{
+  VTable *vtable = new VTable(label, new List<const char *>);
+  vtable->AddSelector(selector1, "_m");
+  if (selector2) vtable->AddSelector(selector2, "_m");
+  code.push_back(vtable);
+  return vtable;
+}
+
+
+    // J.y is found with both of the others, so it is colored first
+    // and the other two, which never meet, share the next slot.
+static void TestColoring()
+{
+  std::list<Instruction*> code;
+  VTable *a = AddVTable(code, "A", "I.x", "J.y");
+  VTable *b = AddVTable(code, "B", "K.z", "J.y");
+  VTable *c = AddVTable(code, "C", "I.x");
+  CodeGenerator::AssignSelectorSlots(&code);
+  CHECK(a->GetSlot(0) == 1 && a->GetSlot(1) == 0);
+  CHECK(b->GetSlot(0) == 1 && b->GetSlot(1) == 0);
+  CHECK(c->GetSlot(0) == 1);
+}
+
+    // A lookup gets the slot of its selector, or 0 if no vtable
+    // provides it and it can never run.
+static void TestLookups()
+{
+  std::list<Instruction*> code;
+  AddVTable(code, "A", "I.x", "I.w");
+  LoadSelector *x = new LoadSelector(t, vt, "I.x");
+  LoadSelector *w = new LoadSelector(t, vt, "I.w");
+  LoadSelector *unused = new LoadSelector(t, vt, "J.y");
+  code.push_back(x);
+  code.push_back(w);
+  code.push_back(unused);
+  CodeGenerator::AssignSelectorSlots(&code);
+  CHECK(x->GetSlot() != w->GetSlot());
+  CHECK(x->GetSlot() >= 0 && x->GetSlot() < 2 && w->GetSlot() >= 0 && w->GetSlot() < 2);
+  CHECK(unused->GetSlot() == 0);
+}
+
+
+int main()
+{
+  TestColoring();
+  TestLookups();
+  return Failures();
+}
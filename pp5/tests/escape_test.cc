@@ -0,0 +1,202 @@
+/* File: escape_test.cc
+ * --------------------
+ * Tests for escape analysis, stack allocation and scalar replacement
+ * (escape.cc). The temporaries scalar replacement makes are numbered
+ * across the whole program, so the expected names follow the order
+ * main runs the tests in.
+ */
+
+#include "check.h"
+#include "optimizer.h"
+
+static Location *o = Local("o", 0), *q = Local("q", 1), *c = Local("c", 2),
+                *v = Local("v", 3), *n = Local("n", 4), *big = Local("big", 5),
+                *g = Global("g", 0);
+
+    // The sequence the front end generates for a New
+static void AddAlloc(TestFunction &f, Location *size, Location *dst)
+{
+  f.Add(new PushParam(size));
+  f.Add(new LCall("_Alloc", dst));
+  f.Add(new PopParams(4));
+}
+
+
+    // Only loads and stores through the object: it moves to the bottom
+    // of the frame, which grows by its size.
+static void TestStackAlloc()
+{
+  TestFunction f(64);
+  f.Add(new LoadConstant(n, 8));
+  AddAlloc(f, n, o);
+  f.Add(new Assign(q, o));
+  f.Add(new Store(q, n, 4, "A"));
+  f.Add(new Load(v, o, 4, "A"));
+  f.Add(new Return(v));
+  AllocateOnStack(f.Graph());
+  CHECK_CODE(f.Code(), "n = 8; o = StackAlloc 8 (fp-76); q = o; *(q + 4) = n; "
+                       "v = *(o + 4); Return v");
+  CHECK(f.begin->GetFrameSize() == 72);
+}
+
+    // Each of these lets the object escape through q, an address
+    // computed from it.
+static void TestEscapes()
+{
+  Instruction *escapes[] = {
+    new Assign(g, q),
+    new Store(v, q, 4, "B"),
+    new PushParam(q),
+    new Return(q),
+  };
+  for (int i = 0; i < sizeof(escapes) / sizeof(escapes[0]); i++) {
+    TestFunction f;
+    f.Add(new LoadConstant(n, 8));
+    AddAlloc(f, n, o);
+    f.Add(new BinaryOp(BinaryOp::Add, q, o, n));
+    f.Add(escapes[i]);
+    FlowGraph *graph = f.Graph();
+    LocationSet aliases;
+    CHECK(ObjectEscapes(graph, o, &aliases));
+    CHECK(aliases.count(o) && aliases.count(q));
+    AllocateOnStack(graph);
+    CHECK(Listing(f.Code()).find("StackAlloc") == std::string::npos);
+  }
+}
+
+    // Comparing the pointer gives a boolean, not another alias.
+static void TestComparison()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 8));
+  AddAlloc(f, n, o);
+  f.Add(new BinaryOp(BinaryOp::Eq, q, o, v));
+  f.Add(new Return(q));
+  LocationSet aliases;
+  CHECK(!ObjectEscapes(f.Graph(), o, &aliases));
+  CHECK(aliases.size() == 1);
+}
+
+    // The size has to be a small constant, a whole number of words.
+static void TestSizes()
+{
+  TestFunction f(64);
+  f.Add(new LoadConstant(big, 132));
+  AddAlloc(f, big, o);
+  f.Add(new LoadConstant(n, 6));
+  AddAlloc(f, n, o);
+  AddAlloc(f, v, o);
+  f.Add(new LoadConstant(q, 8));
+  f.Add(new LoadConstant(q, 12));
+  AddAlloc(f, q, o);
+  AllocateOnStack(f.Graph());
+  CHECK(Listing(f.Code()).find("StackAlloc") == std::string::npos);
+  CHECK(f.begin->GetFrameSize() == 64);
+}
+
+    // In a loop, the slot is reused on every trip, which is only safe
+    // if last trip's object is dead by the time the next is made.
+static void TestLoops()
+{
+  TestFunction f(64);
+  f.Add(new LoadConstant(n, 4));
+  f.Add(new Label("L0"));
+  AddAlloc(f, n, o);
+  f.Add(new Store(o, n, 0, "A"));
+  f.Add(new IfZ(c, "L0"));
+  AllocateOnStack(f.Graph());
+  CHECK_CODE(f.Code(), "n = 4; L0:; o = StackAlloc 4 (fp-72); *(o) = n; IfZ c Goto L0");
+
+  TestFunction g(64);
+  g.Add(new LoadConstant(n, 4));
+  g.Add(new Label("L0"));
+  AddAlloc(g, n, o);
+  g.Add(new Store(o, q, 0, "A"));
+  g.Add(new Assign(q, o));
+  g.Add(new IfZ(c, "L0"));
+  AllocateOnStack(g.Graph());
+  CHECK_CODE(g.Code(), "n = 4; L0:; PushParam n; o = LCall _Alloc; PopParams 4; "
+                       "*(o) = q; q = o; IfZ c Goto L0");
+}
+
+
+static void TestScalars()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 12));
+  AddAlloc(f, n, o);
+  f.Add(new Assign(q, o));
+  f.Add(new NullCheck(q));
+  f.Add(new Store(q, v, 4, "A"));
+  f.Add(new Store(o, c, 8, "A"));
+  f.Add(new Load(v, o, 4, "A"));
+  f.Add(new Return(v));
+  ReplaceObjectsWithScalars(f.Graph());
+  CHECK_CODE(f.Code(), "n = 12; _tmp0 = 0; _tmp1 = 0; _tmp0 = v; _tmp1 = c; "
+                       "v = _tmp0; Return v");
+}
+
+    // The copy and the null check dropped ahead of the allocation used
+    // to leave it at the wrong index, so the wrong instructions were
+    // erased in its place.
+static void TestScalarsAfterDroppedCode()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 8));
+  f.Add(new NullCheck(o));
+  f.Add(new Assign(q, o));
+  AddAlloc(f, n, o);
+  f.Add(new Store(o, v, 4, "A"));
+  f.Add(new Load(v, o, 4, "A"));
+  f.Add(new Return(v));
+  ReplaceObjectsWithScalars(f.Graph());
+  CHECK_CODE(f.Code(), "n = 8; _tmp2 = 0; _tmp2 = v; v = _tmp2; Return v");
+}
+
+    // An object with no fields read or written just disappears, and
+    // the one made right after it is still found.
+static void TestScalarsWithoutFields()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 8));
+  AddAlloc(f, n, o);
+  f.Add(new NullCheck(o));
+  AddAlloc(f, n, q);
+  f.Add(new Store(q, v, 0, "A"));
+  f.Add(new Return(v));
+  ReplaceObjectsWithScalars(f.Graph());
+  CHECK_CODE(f.Code(), "n = 8; _tmp3 = 0; _tmp3 = v; Return v");
+}
+
+    // Computed addresses and uses other than loads, stores, copies and
+    // null checks keep the object in one piece.
+static void TestNoScalars()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 8));
+  AddAlloc(f, n, o);
+  f.Add(new BinaryOp(BinaryOp::Add, q, o, n));
+  f.Add(new Store(q, v, 0, "int[]"));
+  AddAlloc(f, n, q);
+  f.Add(new BinaryOp(BinaryOp::Eq, v, q, c));
+  f.Add(new Return(v));
+  ReplaceObjectsWithScalars(f.Graph());
+  CHECK_CODE(f.Code(), "n = 8; PushParam n; o = LCall _Alloc; PopParams 4; "
+                       "q = o + n; *(q) = v; PushParam n; q = LCall _Alloc; "
+                       "PopParams 4; v = q == c; Return v");
+}
+
+
+int main()
+{
+  TestStackAlloc();
+  TestEscapes();
+  TestComparison();
+  TestSizes();
+  TestLoops();
+  TestScalars();
+  TestScalarsAfterDroppedCode();
+  TestScalarsWithoutFields();
+  TestNoScalars();
+  return Failures();
+}
@@ -0,0 +1,75 @@
+/* File: fastcall_test.cc
+ * ----------------------
+ * Tests for the expansion of built-in calls (fastcall.cc).
+ */
+
+#include "check.h"
+#include "optimizer.h"
+
+static Location *o = Local("o", 0), *n = Local("n", 1), *v = Local("v", 2);
+
+
+    // A constant size is rounded up to whole words and allocated
+    // inline; any other size goes to __Malloc in $a0.
+static void TestAlloc()
+{
+  TestFunction f;
+  f.Add(new LoadConstant(n, 6));
+  f.Add(new PushParam(n));
+  f.Add(new LCall("_Alloc", o));
+  f.Add(new PopParams(4));
+  f.Add(new PushParam(v));
+  f.Add(new LCall("_Alloc", o));
+  f.Add(new PopParams(4));
+  ExpandBuiltIns(f.Graph());
+  CHECK_CODE(f.Code(), "n = 6; o = InlineAlloc 8; o = FastCall __Malloc v");
+}
+
+    // Only the PushParam and PopParams right next to the call are
+    // known to belong to it.
+static void TestAllocApart()
+{
+  TestFunction f;
+  f.Add(new PushParam(v));
+  f.Add(new LoadConstant(n, 8));
+  f.Add(new LCall("_Alloc", o));
+  f.Add(new PopParams(4));
+  ExpandBuiltIns(f.Graph());
+  CHECK_CODE(f.Code(), "PushParam v; n = 8; o = LCall _Alloc; PopParams 4");
+}
+
+static void TestHalt()
+{
+  TestFunction f;
+  f.Add(new LCall("_Halt", NULL));
+  f.Add(new Return(NULL));
+  ExpandBuiltIns(f.Graph());
+  CHECK_CODE(f.Code(), "FastCall __FlushOutput; Syscall 10; Return ");
+}
+
+    // The rest of the built-ins, and user functions, are called as usual,
+    // even one whose label is the run-time routine's without the
+    // reserved prefix.
+static void TestOtherCalls()
+{
+  TestFunction f;
+  f.Add(new PushParam(v));
+  f.Add(new LCall("_PrintInt", NULL));
+  f.Add(new PopParams(4));
+  f.Add(new PushParam(v));
+  f.Add(new LCall("_Malloc", o));
+  f.Add(new PopParams(4));
+  ExpandBuiltIns(f.Graph());
+  CHECK_CODE(f.Code(), "PushParam v; LCall _PrintInt; PopParams 4; "
+                       "PushParam v; o = LCall _Malloc; PopParams 4");
+}
+
+
+int main()
+{
+  TestAlloc();
+  TestAllocApart();
+  TestHalt();
+  TestOtherCalls();
+  return Failures();
+}
@@ -0,0 +1,111 @@
+/* File: nullcheck_test.cc
+ * -----------------------
+ * Tests for null check elimination (nullcheck.cc).
+ */
+
+#include "check.h"
+#include "optimizer.h"
+#include "codegen.h"
+
+static Location *p = Local("p", 0), *q = Local("q", 1), *c = Local("c", 2),
+                *v = Local("v", 3), *s = Local("s", 4);
+
+
+static void TestRepeatedCheck()
+{
+  TestFunction f;
+  f.Add(new NullCheck(p));
+  f.Add(new Load(v, p, 4, "A"));
+  f.Add(new NullCheck(p));
+  f.Add(new NullCheck(q));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "NullCheck p; v = *(p + 4); NullCheck q");
+}
+
+    // A dereference proves its base non-null, unless it overwrites it.
+static void TestDereference()
+{
+  TestFunction f;
+  f.Add(new Store(p, v, 4, "A"));
+  f.Add(new NullCheck(p));
+  f.Add(new Load(p, p, 4, "A"));
+  f.Add(new NullCheck(p));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "*(p + 4) = v; p = *(p + 4); NullCheck p");
+}
+
+static void TestSources()
+{
+  TestFunction f;
+  f.Add(new PushParam(s));
+  f.Add(new LCall("_Alloc", p));
+  f.Add(new PopParams(4));
+  f.Add(new NullCheck(p));
+  f.Add(new LoadStringConstant(s, "\"hi\""));
+  f.Add(new NullCheck(s));
+  f.Add(new Assign(q, p));
+  f.Add(new NullCheck(q));
+  f.Add(new LCall("_f", p));
+  f.Add(new NullCheck(p));
+  f.Add(new Assign(q, v));
+  f.Add(new NullCheck(q));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "PushParam s; p = LCall _Alloc; PopParams 4; s = \"hi\"; "
+                       "q = p; p = LCall _f; NullCheck p; q = v; NullCheck q");
+}
+
+static void TestThis()
+{
+  TestFunction f;
+  f.Add(new NullCheck(CodeGenerator::ThisPtr));
+  f.Add(new Load(v, CodeGenerator::ThisPtr, 4, "A"));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "v = *(this + 4)");
+}
+
+    // At a join a check goes only if every path has checked.
+static void TestJoin()
+{
+  TestFunction f;
+  f.Add(new IfZ(c, "L0"));
+  f.Add(new NullCheck(p));
+  f.Add(new NullCheck(q));
+  f.Add(new Goto("L1"));
+  f.Add(new Label("L0"));
+  f.Add(new Load(v, p, 0, "A"));
+  f.Add(new Label("L1"));
+  f.Add(new NullCheck(p));
+  f.Add(new NullCheck(q));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "IfZ c Goto L0; NullCheck p; NullCheck q; Goto L1; "
+                       "L0:; v = *(p); L1:; NullCheck q");
+}
+
+    // A check before a loop covers the body unless the body assigns
+    // the reference.
+static void TestLoop()
+{
+  TestFunction f;
+  f.Add(new NullCheck(p));
+  f.Add(new NullCheck(q));
+  f.Add(new Label("L0"));
+  f.Add(new NullCheck(p));
+  f.Add(new NullCheck(q));
+  f.Add(new Load(q, q, 4, "A"));
+  f.Add(new IfZ(c, "L0"));
+  EliminateNullChecks(f.Graph());
+  CHECK_CODE(f.Code(), "NullCheck p; NullCheck q; L0:; NullCheck q; "
+                       "q = *(q + 4); IfZ c Goto L0");
+}
+
+
+int main()
+{
+  TestRepeatedCheck();
+  TestDereference();
+  TestSources();
+  TestThis();
+  TestJoin();
+  TestLoop();
+  return Failures();
+}
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2013 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 6 "parser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 6 "parser.y"
 
 
 #include "scanner.h" // for yylex
@@ -72,26 +77,31 @@
 void yyerror(const char *msg); // standard error-handling routine
 
 
-#line 76 "y.tab.c" /* yacc.c:339  */
+#line 81 "y.tab.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "y.tab.h".  */
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
 #ifndef YY_YY_Y_TAB_H_INCLUDED
 # define YY_YY_Y_TAB_H_INCLUDED
 /* Debug traces.  */
@@ -102,50 +112,59 @@ void yyerror(const char *msg); // standard error-handling routine
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    T_Void = 258,
-    T_Bool = 259,
-    T_Int = 260,
-    T_Double = 261,
-    T_String = 262,
-    T_Class = 263,
-    T_LessEqual = 264,
-    T_GreaterEqual = 265,
-    T_Equal = 266,
-    T_NotEqual = 267,
-    T_Dims = 268,
-    T_And = 269,
-    T_Or = 270,
-    T_Null = 271,
-    T_Extends = 272,
-    T_This = 273,
-    T_Interface = 274,
-    T_Implements = 275,
-    T_While = 276,
-    T_For = 277,
-    T_If = 278,
-    T_Else = 279,
-    T_Return = 280,
-    T_Break = 281,
-    T_New = 282,
-    T_NewArray = 283,
-    T_Print = 284,
-    T_ReadInteger = 285,
-    T_ReadLine = 286,
-    T_Identifier = 287,
-    T_StringConstant = 288,
-    T_IntConstant = 289,
-    T_DoubleConstant = 290,
-    T_BoolConstant = 291,
-    T_UnaryMinus = 292,
-    T_Lower_Than_Else = 293
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    T_Void = 258,                  /* T_Void  */
+    T_Bool = 259,                  /* T_Bool  */
+    T_Int = 260,                   /* T_Int  */
+    T_Double = 261,                /* T_Double  */
+    T_String = 262,                /* T_String  */
+    T_Class = 263,                 /* T_Class  */
+    T_LessEqual = 264,             /* T_LessEqual  */
+    T_GreaterEqual = 265,          /* T_GreaterEqual  */
+    T_Equal = 266,                 /* T_Equal  */
+    T_NotEqual = 267,              /* T_NotEqual  */
+    T_Dims = 268,                  /* T_Dims  */
+    T_And = 269,                   /* T_And  */
+    T_Or = 270,                    /* T_Or  */
+    T_Null = 271,                  /* T_Null  */
+    T_Extends = 272,               /* T_Extends  */
+    T_This = 273,                  /* T_This  */
+    T_Interface = 274,             /* T_Interface  */
+    T_Implements = 275,            /* T_Implements  */
+    T_While = 276,                 /* T_While  */
+    T_For = 277,                   /* T_For  */
+    T_If = 278,                    /* T_If  */
+    T_Else = 279,                  /* T_Else  */
+    T_Return = 280,                /* T_Return  */
+    T_Break = 281,                 /* T_Break  */
+    T_New = 282,                   /* T_New  */
+    T_NewArray = 283,              /* T_NewArray  */
+    T_Print = 284,                 /* T_Print  */
+    T_ReadInteger = 285,           /* T_ReadInteger  */
+    T_ReadLine = 286,              /* T_ReadLine  */
+    T_Identifier = 287,            /* T_Identifier  */
+    T_StringConstant = 288,        /* T_StringConstant  */
+    T_IntConstant = 289,           /* T_IntConstant  */
+    T_DoubleConstant = 290,        /* T_DoubleConstant  */
+    T_BoolConstant = 291,          /* T_BoolConstant  */
+    T_UnaryMinus = 292,            /* T_UnaryMinus  */
+    T_Lower_Than_Else = 293        /* T_Lower_Than_Else  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define T_Void 258
 #define T_Bool 259
 #define T_Int 260
@@ -185,16 +204,15 @@ extern int yydebug;
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE YYSTYPE;
 union YYSTYPE
 {
-#line 20 "parser.y" /* yacc.c:355  */
+#line 20 "parser.y"
 
     int integerConstant;
     bool boolConstant;
     char *stringConstant;
     double doubleConstant;
-    char identifier[MaxIdentLen+1]; // +1 for terminating null
+    Symbol identifier;              // interned name, see symtab.h
     Decl *decl;
     List<Decl*> *declList;
     Type *type;
@@ -209,8 +227,10 @@ union YYSTYPE
     List<Stmt*> *stmtList;
     LValue *lvalue;
 
-#line 213 "y.tab.c" /* yacc.c:355  */
+#line 231 "y.tab.c"
+
 };
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
 #endif
@@ -232,40 +252,194 @@ struct YYLTYPE
 
 extern YYSTYPE yylval;
 extern YYLTYPE yylloc;
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_T_Void = 3,                     /* T_Void  */
+  YYSYMBOL_T_Bool = 4,                     /* T_Bool  */
+  YYSYMBOL_T_Int = 5,                      /* T_Int  */
+  YYSYMBOL_T_Double = 6,                   /* T_Double  */
+  YYSYMBOL_T_String = 7,                   /* T_String  */
+  YYSYMBOL_T_Class = 8,                    /* T_Class  */
+  YYSYMBOL_T_LessEqual = 9,                /* T_LessEqual  */
+  YYSYMBOL_T_GreaterEqual = 10,            /* T_GreaterEqual  */
+  YYSYMBOL_T_Equal = 11,                   /* T_Equal  */
+  YYSYMBOL_T_NotEqual = 12,                /* T_NotEqual  */
+  YYSYMBOL_T_Dims = 13,                    /* T_Dims  */
+  YYSYMBOL_T_And = 14,                     /* T_And  */
+  YYSYMBOL_T_Or = 15,                      /* T_Or  */
+  YYSYMBOL_T_Null = 16,                    /* T_Null  */
+  YYSYMBOL_T_Extends = 17,                 /* T_Extends  */
+  YYSYMBOL_T_This = 18,                    /* T_This  */
+  YYSYMBOL_T_Interface = 19,               /* T_Interface  */
+  YYSYMBOL_T_Implements = 20,              /* T_Implements  */
+  YYSYMBOL_T_While = 21,                   /* T_While  */
+  YYSYMBOL_T_For = 22,                     /* T_For  */
+  YYSYMBOL_T_If = 23,                      /* T_If  */
+  YYSYMBOL_T_Else = 24,                    /* T_Else  */
+  YYSYMBOL_T_Return = 25,                  /* T_Return  */
+  YYSYMBOL_T_Break = 26,                   /* T_Break  */
+  YYSYMBOL_T_New = 27,                     /* T_New  */
+  YYSYMBOL_T_NewArray = 28,                /* T_NewArray  */
+  YYSYMBOL_T_Print = 29,                   /* T_Print  */
+  YYSYMBOL_T_ReadInteger = 30,             /* T_ReadInteger  */
+  YYSYMBOL_T_ReadLine = 31,                /* T_ReadLine  */
+  YYSYMBOL_T_Identifier = 32,              /* T_Identifier  */
+  YYSYMBOL_T_StringConstant = 33,          /* T_StringConstant  */
+  YYSYMBOL_T_IntConstant = 34,             /* T_IntConstant  */
+  YYSYMBOL_T_DoubleConstant = 35,          /* T_DoubleConstant  */
+  YYSYMBOL_T_BoolConstant = 36,            /* T_BoolConstant  */
+  YYSYMBOL_37_ = 37,                       /* '='  */
+  YYSYMBOL_38_ = 38,                       /* '<'  */
+  YYSYMBOL_39_ = 39,                       /* '>'  */
+  YYSYMBOL_40_ = 40,                       /* '+'  */
+  YYSYMBOL_41_ = 41,                       /* '-'  */
+  YYSYMBOL_42_ = 42,                       /* '*'  */
+  YYSYMBOL_43_ = 43,                       /* '/'  */
+  YYSYMBOL_44_ = 44,                       /* '%'  */
+  YYSYMBOL_T_UnaryMinus = 45,              /* T_UnaryMinus  */
+  YYSYMBOL_46_ = 46,                       /* '!'  */
+  YYSYMBOL_47_ = 47,                       /* '.'  */
+  YYSYMBOL_48_ = 48,                       /* '['  */
+  YYSYMBOL_T_Lower_Than_Else = 49,         /* T_Lower_Than_Else  */
+  YYSYMBOL_50_ = 50,                       /* ';'  */
+  YYSYMBOL_51_ = 51,                       /* '{'  */
+  YYSYMBOL_52_ = 52,                       /* '}'  */
+  YYSYMBOL_53_ = 53,                       /* ','  */
+  YYSYMBOL_54_ = 54,                       /* '('  */
+  YYSYMBOL_55_ = 55,                       /* ')'  */
+  YYSYMBOL_56_ = 56,                       /* ']'  */
+  YYSYMBOL_YYACCEPT = 57,                  /* $accept  */
+  YYSYMBOL_Program = 58,                   /* Program  */
+  YYSYMBOL_DeclList = 59,                  /* DeclList  */
+  YYSYMBOL_Decl = 60,                      /* Decl  */
+  YYSYMBOL_VarDecl = 61,                   /* VarDecl  */
+  YYSYMBOL_Variable = 62,                  /* Variable  */
+  YYSYMBOL_Type = 63,                      /* Type  */
+  YYSYMBOL_IntfDecl = 64,                  /* IntfDecl  */
+  YYSYMBOL_IntfList = 65,                  /* IntfList  */
+  YYSYMBOL_ClassDecl = 66,                 /* ClassDecl  */
+  YYSYMBOL_OptExt = 67,                    /* OptExt  */
+  YYSYMBOL_OptImpl = 68,                   /* OptImpl  */
+  YYSYMBOL_ImpList = 69,                   /* ImpList  */
+  YYSYMBOL_FieldList = 70,                 /* FieldList  */
+  YYSYMBOL_Field = 71,                     /* Field  */
+  YYSYMBOL_FnHeader = 72,                  /* FnHeader  */
+  YYSYMBOL_Formals = 73,                   /* Formals  */
+  YYSYMBOL_FormalList = 74,                /* FormalList  */
+  YYSYMBOL_FnDecl = 75,                    /* FnDecl  */
+  YYSYMBOL_StmtBlock = 76,                 /* StmtBlock  */
+  YYSYMBOL_VarDecls = 77,                  /* VarDecls  */
+  YYSYMBOL_StmtList = 78,                  /* StmtList  */
+  YYSYMBOL_Stmt = 79,                      /* Stmt  */
+  YYSYMBOL_LValue = 80,                    /* LValue  */
+  YYSYMBOL_Call = 81,                      /* Call  */
+  YYSYMBOL_OptExpr = 82,                   /* OptExpr  */
+  YYSYMBOL_Expr = 83,                      /* Expr  */
+  YYSYMBOL_Constant = 84,                  /* Constant  */
+  YYSYMBOL_Actuals = 85,                   /* Actuals  */
+  YYSYMBOL_ExprList = 86,                  /* ExprList  */
+  YYSYMBOL_OptElse = 87                    /* OptElse  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
-/* Copy the second part of user declarations.  */
 
-#line 242 "y.tab.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -273,15 +447,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -295,47 +482,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -348,8 +531,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -414,8 +611,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -425,18 +621,19 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
   YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -449,11 +646,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -465,12 +662,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -482,28 +679,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  22
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   566
+#define YYLAST   528
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  57
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  31
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  94
+#define YYNRULES  95
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  183
+#define YYNSTATES  184
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   293
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -538,265 +738,257 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,    98,    98,   110,   111,   114,   115,   116,   117,   120,
-     123,   126,   127,   128,   129,   130,   131,   134,   138,   140,
-     143,   147,   149,   152,   154,   157,   159,   162,   163,   166,
-     167,   171,   173,   177,   178,   181,   183,   186,   189,   193,
-     194,   197,   198,   201,   202,   203,   205,   207,   209,   211,
-     213,   215,   218,   219,   220,   223,   225,   229,   230,   233,
-     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
-     244,   245,   246,   248,   250,   251,   252,   253,   255,   256,
-     258,   259,   261,   263,   266,   267,   268,   269,   270,   273,
-     274,   277,   278,   281,   282
+       0,    98,    98,   111,   112,   115,   116,   117,   118,   121,
+     124,   127,   128,   129,   130,   131,   132,   135,   139,   141,
+     144,   148,   150,   153,   155,   158,   160,   163,   164,   167,
+     168,   172,   174,   178,   179,   182,   184,   187,   190,   192,
+     195,   196,   203,   204,   207,   208,   209,   211,   213,   215,
+     217,   219,   221,   224,   225,   226,   229,   231,   235,   236,
+     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   254,   256,   257,   258,   259,   261,
+     262,   264,   265,   267,   269,   272,   273,   274,   275,   276,
+     279,   280,   283,   284,   287,   288
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "T_Void", "T_Bool", "T_Int", "T_Double",
-  "T_String", "T_Class", "T_LessEqual", "T_GreaterEqual", "T_Equal",
-  "T_NotEqual", "T_Dims", "T_And", "T_Or", "T_Null", "T_Extends", "T_This",
-  "T_Interface", "T_Implements", "T_While", "T_For", "T_If", "T_Else",
-  "T_Return", "T_Break", "T_New", "T_NewArray", "T_Print", "T_ReadInteger",
-  "T_ReadLine", "T_Identifier", "T_StringConstant", "T_IntConstant",
-  "T_DoubleConstant", "T_BoolConstant", "'='", "'<'", "'>'", "'+'", "'-'",
-  "'*'", "'/'", "'%'", "T_UnaryMinus", "'!'", "'.'", "'['",
-  "T_Lower_Than_Else", "';'", "'{'", "'}'", "','", "'('", "')'", "']'",
-  "$accept", "Program", "DeclList", "Decl", "VarDecl", "Variable", "Type",
-  "IntfDecl", "IntfList", "ClassDecl", "OptExt", "OptImpl", "ImpList",
-  "FieldList", "Field", "FnHeader", "Formals", "FormalList", "FnDecl",
-  "StmtBlock", "VarDecls", "StmtList", "Stmt", "LValue", "Call", "OptExpr",
-  "Expr", "Constant", "Actuals", "ExprList", "OptElse", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "T_Void", "T_Bool",
+  "T_Int", "T_Double", "T_String", "T_Class", "T_LessEqual",
+  "T_GreaterEqual", "T_Equal", "T_NotEqual", "T_Dims", "T_And", "T_Or",
+  "T_Null", "T_Extends", "T_This", "T_Interface", "T_Implements",
+  "T_While", "T_For", "T_If", "T_Else", "T_Return", "T_Break", "T_New",
+  "T_NewArray", "T_Print", "T_ReadInteger", "T_ReadLine", "T_Identifier",
+  "T_StringConstant", "T_IntConstant", "T_DoubleConstant",
+  "T_BoolConstant", "'='", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'",
+  "T_UnaryMinus", "'!'", "'.'", "'['", "T_Lower_Than_Else", "';'", "'{'",
+  "'}'", "','", "'('", "')'", "']'", "$accept", "Program", "DeclList",
+  "Decl", "VarDecl", "Variable", "Type", "IntfDecl", "IntfList",
+  "ClassDecl", "OptExt", "OptImpl", "ImpList", "FieldList", "Field",
+  "FnHeader", "Formals", "FormalList", "FnDecl", "StmtBlock", "VarDecls",
+  "StmtList", "Stmt", "LValue", "Call", "OptExpr", "Expr", "Constant",
+  "Actuals", "ExprList", "OptElse", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,    61,    60,    62,
-      43,    45,    42,    47,    37,   292,    33,    46,    91,   293,
-      59,   123,   125,    44,    40,    41,    93
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -131
+#define YYPACT_NINF (-84)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-131)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -59
+#define YYTABLE_NINF (-16)
 
-#define yytable_value_is_error(Yytable_value) \
-  (!!((Yytable_value) == (-59)))
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      77,     1,  -131,  -131,  -131,  -131,     6,     7,  -131,    32,
-      77,  -131,  -131,   -10,    -1,  -131,  -131,    20,  -131,   -13,
-      33,    22,  -131,  -131,  -131,  -131,    21,  -131,  -131,   123,
-      17,    54,  -131,   123,    72,  -131,     4,    31,    34,  -131,
-      79,    61,     2,    60,  -131,  -131,    62,    65,    67,   483,
-      74,    71,    78,    83,    86,    87,    -2,  -131,  -131,  -131,
-    -131,   512,   512,   512,  -131,  -131,    90,   417,    94,  -131,
-      93,   308,  -131,  -131,  -131,   123,  -131,    95,  -131,  -131,
-      59,   104,  -131,   512,   512,   512,   105,  -131,   253,  -131,
-     126,   512,   512,   114,   115,   512,   -22,   -22,   135,  -131,
-    -131,   512,  -131,   512,   512,   512,   512,   512,   512,   512,
-     512,   512,   512,   512,   512,   512,   128,   512,  -131,   149,
-      16,    21,  -131,   177,   134,   195,  -131,   130,   237,   308,
-     -37,  -131,  -131,   138,   141,  -131,   308,   384,   384,   359,
-     359,   370,   348,   384,   384,   109,   109,   -22,   -22,   -22,
-     142,   124,  -131,  -131,  -131,  -131,  -131,   454,   512,   454,
-    -131,   123,   512,   145,  -131,   512,  -131,  -131,   295,   173,
-      -9,   308,  -131,   143,   512,   454,  -131,  -131,  -131,   144,
-    -131,   454,  -131
+      75,   -25,   -84,   -84,   -84,   -84,   -21,     3,   -84,    39,
+      75,   -84,   -84,   -10,    -1,   -84,   -84,    -8,   -84,   -13,
+      29,    37,   -84,   -84,   -84,   -84,    -3,   -84,   -84,    80,
+      21,    69,   -84,    80,   118,   -84,     2,    36,    40,   -84,
+      64,    47,    17,    44,   -84,   -84,    54,    60,    66,   445,
+      79,    76,    81,    83,    88,   109,    -7,   -84,   -84,   -84,
+     -84,   474,   474,   -84,   474,   -84,   -84,   379,   -84,    96,
+     -84,   115,   289,   -84,   -84,   -84,    80,   -84,    63,   -84,
+     -84,     5,   116,   -84,   474,   474,   474,   113,   -84,   228,
+     -84,   106,   474,   474,   123,   126,   474,   -15,   -15,    62,
+     -84,   -84,   474,   -84,   474,   474,   474,   474,   474,   474,
+     474,   474,   474,   474,   474,   474,   474,   136,   474,   -84,
+     139,    23,    -3,   -84,   165,   132,   186,   -84,   128,   207,
+     289,   -36,   -84,   -84,   137,   120,   -84,   289,   346,   346,
+     310,   310,   329,   270,   346,   346,    84,    84,   -15,   -15,
+     -15,   145,   146,   -84,   -84,   -84,   -84,   -84,   416,   474,
+     416,   -84,    80,   474,   141,   -84,   474,   -84,   -84,   247,
+     187,    -5,   289,   -84,   155,   474,   416,   -84,   -84,   -84,
+     159,   -84,   416,   -84
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint8 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
 {
        0,     0,    12,    11,    14,    13,     0,     0,    15,     0,
        2,     4,     7,     0,     0,     8,     5,     0,     6,     0,
-      22,     0,     1,     3,     9,    16,    10,    40,    37,    34,
-       0,    24,    19,    34,    42,    36,     0,     0,    33,    21,
-       0,     0,     0,     0,    88,    83,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    52,    87,    84,    86,
-      85,     0,     0,     0,    39,    44,     0,    42,    59,    60,
-       0,    57,    61,    10,    32,     0,    26,    23,    28,    17,
-       0,     0,    31,     0,    58,     0,    52,    49,     0,    51,
-       0,     0,     0,     0,     0,    90,    77,    78,     0,    38,
-      41,     0,    43,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    35,     0,
-       0,     0,    18,     0,     0,     0,    48,     0,     0,    92,
-       0,    79,    80,     0,    89,    76,    62,    72,    73,    68,
-      69,    74,    75,    70,    71,    63,    64,    66,    65,    67,
-      53,     0,    25,    20,    29,    27,    30,    58,     0,    58,
-      81,     0,     0,     0,    55,    90,    54,    46,     0,    94,
-       0,    91,    50,     0,    58,    58,    45,    82,    56,     0,
-      93,    58,    47
+      22,     0,     1,     3,     9,    16,    10,    41,    37,    34,
+       0,    24,    19,    34,    59,    36,     0,     0,    33,    21,
+       0,     0,     0,     0,    89,    84,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    53,    88,    85,    87,
+      86,     0,     0,    39,     0,    40,    45,    59,    43,    60,
+      61,     0,    58,    62,    10,    32,     0,    26,    23,    28,
+      17,     0,     0,    31,     0,    59,     0,    53,    50,     0,
+      52,     0,     0,     0,     0,     0,    91,    78,    79,     0,
+      38,    42,     0,    44,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    35,
+       0,     0,     0,    18,     0,     0,     0,    49,     0,     0,
+      93,     0,    80,    81,     0,    90,    77,    63,    73,    74,
+      69,    70,    75,    76,    71,    72,    64,    65,    67,    66,
+      68,    54,     0,    25,    20,    29,    27,    30,    59,     0,
+      59,    82,     0,     0,     0,    56,    91,    55,    47,     0,
+      95,     0,    92,    51,     0,    59,    59,    46,    83,    57,
+       0,    94,    59,    48
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -131,  -131,  -131,   190,   -31,    -5,     0,  -131,  -131,  -131,
-    -131,  -131,  -131,  -131,  -131,   159,   169,  -131,    88,   186,
-    -131,   146,  -130,  -131,  -131,   -82,   -48,  -131,    46,   120,
-    -131
+     -84,   -84,   -84,   205,   -31,   -24,     0,   -84,   -84,   -84,
+     -84,   -84,   -84,   -84,   -84,   181,   198,   -84,   111,   218,
+     -84,   -84,   -63,   -84,   -84,   -83,   -48,   -84,    70,   151,
+     -84
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
 {
-      -1,     9,    10,    11,    12,    13,    36,    15,    42,    16,
-      31,    41,    77,   120,   155,    17,    37,    38,    18,    65,
-      34,    66,    67,    68,    69,    70,    71,    72,   133,   134,
-     176
+       0,     9,    10,    11,    12,    13,    36,    15,    42,    16,
+      31,    41,    78,   121,   156,    17,    37,    38,    18,    66,
+      34,    67,    68,    69,    70,    71,    72,    73,   134,   135,
+     177
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      14,    88,   124,    64,    25,     1,     2,     3,     4,     5,
-      14,   -15,    25,    96,    97,    98,   162,    25,   163,     1,
-       2,     3,     4,     5,    35,   116,   117,   167,    35,   169,
-     -15,    26,    22,    19,     8,   123,    73,   125,    20,    21,
-      24,    29,    80,   128,   129,   180,   177,   129,     8,    39,
-      30,   182,    95,   136,    79,   137,   138,   139,   140,   141,
-     142,   143,   144,   145,   146,   147,   148,   149,   153,   151,
-     118,    27,    25,    32,    40,    33,     2,     3,     4,     5,
-       1,     2,     3,     4,     5,     6,    74,    75,    44,   154,
-      45,   121,   179,    46,    47,    48,     7,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,     8,
-     168,    76,    78,    61,   171,    82,    83,   129,    62,    84,
-      14,    85,   -58,    27,    89,    90,    63,     2,     3,     4,
-       5,   101,    91,   103,   104,   105,   106,    92,   107,   108,
-      93,    94,    99,   102,   103,   104,   105,   106,   119,   107,
-     108,   113,   114,   115,   122,     8,   116,   117,   127,    95,
-     150,   170,   109,   110,   111,   112,   113,   114,   115,   131,
-     132,   116,   117,   109,   110,   111,   112,   113,   114,   115,
-     166,   152,   116,   117,   158,   160,   103,   104,   105,   106,
-     135,   107,   108,   164,   162,   172,   165,   175,   178,   181,
-      23,    81,    43,    28,   103,   104,   105,   106,   156,   107,
-     108,   173,   130,   100,     0,   109,   110,   111,   112,   113,
-     114,   115,     0,     0,   116,   117,     0,     0,     0,     0,
-       0,     0,   157,   109,   110,   111,   112,   113,   114,   115,
-       0,     0,   116,   117,     0,     0,   103,   104,   105,   106,
-     159,   107,   108,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   103,   104,   105,   106,     0,   107,   108,     0,
-       0,     0,     0,     0,     0,   109,   110,   111,   112,   113,
-     114,   115,     0,     0,   116,   117,     0,     0,     0,     0,
-     161,   109,   110,   111,   112,   113,   114,   115,     0,     0,
-     116,   117,     0,   126,   103,   104,   105,   106,     0,   107,
-     108,     0,     0,     0,     0,     0,     0,   103,   104,   105,
-     106,     0,   107,   108,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   109,   110,   111,   112,   113,   114,   115,
-       0,     0,   116,   117,     0,   174,   109,   110,   111,   112,
-     113,   114,   115,     0,     0,   116,   117,   103,   104,   105,
-     106,     0,   107,     0,     0,     0,     0,     0,   103,   104,
-     -59,   -59,     0,     0,     0,     0,     0,     0,     0,   103,
-     104,   105,   106,     0,     0,     0,   109,   110,   111,   112,
-     113,   114,   115,   -59,   -59,   116,   117,   109,   110,   111,
-     112,   113,   114,   115,     0,     0,   116,   117,   109,   110,
-     111,   112,   113,   114,   115,     0,     0,   116,   117,     0,
-       0,     0,   -59,   -59,   111,   112,   113,   114,   115,     0,
-       0,   116,   117,    44,     0,    45,     0,     0,    46,    47,
-      48,     0,    49,    50,    51,    52,    53,    54,    55,    86,
-      57,    58,    59,    60,     0,     0,     0,     0,    61,     0,
-       0,     0,     0,    62,     0,     0,     0,   -58,    27,     0,
-      44,    63,    45,     0,     0,    46,    47,    48,     0,    49,
-      50,    51,    52,    53,    54,    55,    86,    57,    58,    59,
-      60,     0,     0,     0,     0,    61,     0,     0,     0,    44,
-      62,    45,     0,     0,     0,    27,     0,     0,    63,     0,
-      51,    52,     0,    54,    55,    86,    57,    58,    59,    60,
-       0,     0,     0,     0,    61,     0,     0,     0,    44,    62,
-      45,     0,     0,    87,     0,     0,     0,    63,     0,    51,
-      52,     0,    54,    55,    86,    57,    58,    59,    60,     0,
-       0,     0,     0,    61,     0,     0,     0,     0,    62,     0,
-       0,     0,     0,     0,     0,     0,    63
+      14,    89,   125,    65,   101,    35,   -15,    19,    25,    35,
+      14,    20,    25,    97,    98,    25,    99,   163,    25,   164,
+       1,     2,     3,     4,     5,   -15,     1,     2,     3,     4,
+       5,    26,   117,   118,    74,    21,   124,   122,   126,    22,
+      24,    29,    81,    27,   129,   130,    30,    96,   130,     8,
+     178,    33,   119,    39,   137,     8,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    80,
+     152,   104,   105,   106,   107,   154,   108,   109,     1,     2,
+       3,     4,     5,     6,     2,     3,     4,     5,    32,    40,
+     155,    75,   180,    76,     7,   168,    77,   170,    79,    83,
+     110,   111,   112,   113,   114,   115,   116,     8,    84,   117,
+     118,   169,     8,   181,    85,   172,   120,   136,   130,   183,
+      86,    14,     2,     3,     4,     5,   114,   115,   116,    90,
+      91,   117,   118,   102,    44,    92,    45,    93,   128,    46,
+      47,    48,    94,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,   104,   105,   106,   107,    61,
+     108,   109,   171,    95,    62,   103,   123,    96,   151,    27,
+      63,   153,    64,   163,   104,   105,   106,   107,   132,   108,
+     109,   133,   159,   161,   110,   111,   112,   113,   114,   115,
+     116,   173,   165,   117,   118,   104,   105,   106,   107,   166,
+     108,   109,   167,   110,   111,   112,   113,   114,   115,   116,
+     179,   176,   117,   118,   182,    23,   104,   105,   106,   107,
+     158,   108,   109,    82,   110,   111,   112,   113,   114,   115,
+     116,    43,   157,   117,   118,    28,   174,   104,   105,   106,
+     107,   160,   108,   109,   131,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,   117,   118,   104,   105,   106,   107,
+     162,   108,   109,     0,     0,     0,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,   117,   118,     0,   127,   104,
+     105,   106,   107,     0,   108,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,   117,   118,     0,   175,   104,   105,
+     106,   107,     0,   108,   109,     0,     0,     0,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,   117,   118,   104,
+     105,   -16,   -16,     0,     0,     0,     0,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,   117,   118,   104,   105,
+     106,   107,     0,     0,     0,     0,     0,     0,   110,   111,
+     112,   113,   114,   115,   116,   -16,   -16,   117,   118,     0,
+       0,     0,     0,     0,     0,     0,     0,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,   117,   118,     0,     0,
+       0,     0,     0,     0,   -16,   -16,   112,   113,   114,   115,
+     116,     0,     0,   117,   118,    44,     0,    45,     0,     0,
+      46,    47,    48,     0,    49,    50,    51,    52,    53,    54,
+      55,    87,    57,    58,    59,    60,     0,     0,     0,     0,
+      61,     0,     0,     0,     0,    62,     0,     0,     0,     0,
+      27,   100,    44,    64,    45,     0,     0,    46,    47,    48,
+       0,    49,    50,    51,    52,    53,    54,    55,    87,    57,
+      58,    59,    60,     0,     0,     0,     0,    61,     0,     0,
+       0,    44,    62,    45,     0,     0,     0,    27,     0,     0,
+      64,     0,    51,    52,     0,    54,    55,    87,    57,    58,
+      59,    60,     0,     0,     0,     0,    61,     0,     0,     0,
+      44,    62,    45,     0,     0,    88,     0,     0,     0,    64,
+       0,    51,    52,     0,    54,    55,    87,    57,    58,    59,
+      60,     0,     0,     0,     0,    61,     0,     0,     0,     0,
+      62,     0,     0,     0,     0,     0,     0,     0,    64
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    49,    84,    34,    13,     3,     4,     5,     6,     7,
-      10,    13,    13,    61,    62,    63,    53,    13,    55,     3,
-       4,     5,     6,     7,    29,    47,    48,   157,    33,   159,
-      32,    32,     0,    32,    32,    83,    32,    85,    32,    32,
-      50,    54,    42,    91,    92,   175,    55,    95,    32,    32,
-      17,   181,    54,   101,    52,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   115,    52,   117,
-      75,    51,    13,    51,    20,    54,     4,     5,     6,     7,
-       3,     4,     5,     6,     7,     8,    55,    53,    16,   120,
-      18,    32,   174,    21,    22,    23,    19,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    32,
-     158,    32,    51,    41,   162,    55,    54,   165,    46,    54,
-     120,    54,    50,    51,    50,    54,    54,     4,     5,     6,
-       7,    37,    54,     9,    10,    11,    12,    54,    14,    15,
-      54,    54,    52,    50,     9,    10,    11,    12,    53,    14,
-      15,    42,    43,    44,    50,    32,    47,    48,    32,    54,
-      32,   161,    38,    39,    40,    41,    42,    43,    44,    55,
-      55,    47,    48,    38,    39,    40,    41,    42,    43,    44,
-      56,    32,    47,    48,    50,    55,     9,    10,    11,    12,
-      55,    14,    15,    55,    53,    50,    54,    24,    55,    55,
-      10,    42,    33,    17,     9,    10,    11,    12,   120,    14,
-      15,   165,    92,    67,    -1,    38,    39,    40,    41,    42,
-      43,    44,    -1,    -1,    47,    48,    -1,    -1,    -1,    -1,
-      -1,    -1,    55,    38,    39,    40,    41,    42,    43,    44,
-      -1,    -1,    47,    48,    -1,    -1,     9,    10,    11,    12,
-      55,    14,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,     9,    10,    11,    12,    -1,    14,    15,    -1,
-      -1,    -1,    -1,    -1,    -1,    38,    39,    40,    41,    42,
-      43,    44,    -1,    -1,    47,    48,    -1,    -1,    -1,    -1,
-      53,    38,    39,    40,    41,    42,    43,    44,    -1,    -1,
-      47,    48,    -1,    50,     9,    10,    11,    12,    -1,    14,
-      15,    -1,    -1,    -1,    -1,    -1,    -1,     9,    10,    11,
-      12,    -1,    14,    15,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    38,    39,    40,    41,    42,    43,    44,
-      -1,    -1,    47,    48,    -1,    50,    38,    39,    40,    41,
-      42,    43,    44,    -1,    -1,    47,    48,     9,    10,    11,
-      12,    -1,    14,    -1,    -1,    -1,    -1,    -1,     9,    10,
-      11,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     9,
-      10,    11,    12,    -1,    -1,    -1,    38,    39,    40,    41,
-      42,    43,    44,     9,    10,    47,    48,    38,    39,    40,
-      41,    42,    43,    44,    -1,    -1,    47,    48,    38,    39,
-      40,    41,    42,    43,    44,    -1,    -1,    47,    48,    -1,
-      -1,    -1,    38,    39,    40,    41,    42,    43,    44,    -1,
-      -1,    47,    48,    16,    -1,    18,    -1,    -1,    21,    22,
-      23,    -1,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    -1,    -1,    -1,    -1,    41,    -1,
-      -1,    -1,    -1,    46,    -1,    -1,    -1,    50,    51,    -1,
-      16,    54,    18,    -1,    -1,    21,    22,    23,    -1,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    -1,    -1,    -1,    -1,    41,    -1,    -1,    -1,    16,
-      46,    18,    -1,    -1,    -1,    51,    -1,    -1,    54,    -1,
-      27,    28,    -1,    30,    31,    32,    33,    34,    35,    36,
-      -1,    -1,    -1,    -1,    41,    -1,    -1,    -1,    16,    46,
-      18,    -1,    -1,    50,    -1,    -1,    -1,    54,    -1,    27,
-      28,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
-      -1,    -1,    -1,    41,    -1,    -1,    -1,    -1,    46,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    54
+       0,    49,    85,    34,    67,    29,    13,    32,    13,    33,
+      10,    32,    13,    61,    62,    13,    64,    53,    13,    55,
+       3,     4,     5,     6,     7,    32,     3,     4,     5,     6,
+       7,    32,    47,    48,    32,    32,    84,    32,    86,     0,
+      50,    54,    42,    51,    92,    93,    17,    54,    96,    32,
+      55,    54,    76,    32,   102,    32,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,    52,
+     118,     9,    10,    11,    12,    52,    14,    15,     3,     4,
+       5,     6,     7,     8,     4,     5,     6,     7,    51,    20,
+     121,    55,   175,    53,    19,   158,    32,   160,    51,    55,
+      38,    39,    40,    41,    42,    43,    44,    32,    54,    47,
+      48,   159,    32,   176,    54,   163,    53,    55,   166,   182,
+      54,   121,     4,     5,     6,     7,    42,    43,    44,    50,
+      54,    47,    48,    37,    16,    54,    18,    54,    32,    21,
+      22,    23,    54,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,     9,    10,    11,    12,    41,
+      14,    15,   162,    54,    46,    50,    50,    54,    32,    51,
+      52,    32,    54,    53,     9,    10,    11,    12,    55,    14,
+      15,    55,    50,    55,    38,    39,    40,    41,    42,    43,
+      44,    50,    55,    47,    48,     9,    10,    11,    12,    54,
+      14,    15,    56,    38,    39,    40,    41,    42,    43,    44,
+      55,    24,    47,    48,    55,    10,     9,    10,    11,    12,
+      55,    14,    15,    42,    38,    39,    40,    41,    42,    43,
+      44,    33,   121,    47,    48,    17,   166,     9,    10,    11,
+      12,    55,    14,    15,    93,    38,    39,    40,    41,    42,
+      43,    44,    -1,    -1,    47,    48,     9,    10,    11,    12,
+      53,    14,    15,    -1,    -1,    -1,    38,    39,    40,    41,
+      42,    43,    44,    -1,    -1,    47,    48,    -1,    50,     9,
+      10,    11,    12,    -1,    14,    38,    39,    40,    41,    42,
+      43,    44,    -1,    -1,    47,    48,    -1,    50,     9,    10,
+      11,    12,    -1,    14,    15,    -1,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    44,    -1,    -1,    47,    48,     9,
+      10,    11,    12,    -1,    -1,    -1,    -1,    38,    39,    40,
+      41,    42,    43,    44,    -1,    -1,    47,    48,     9,    10,
+      11,    12,    -1,    -1,    -1,    -1,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    44,     9,    10,    47,    48,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    39,    40,
+      41,    42,    43,    44,    -1,    -1,    47,    48,    -1,    -1,
+      -1,    -1,    -1,    -1,    38,    39,    40,    41,    42,    43,
+      44,    -1,    -1,    47,    48,    16,    -1,    18,    -1,    -1,
+      21,    22,    23,    -1,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    -1,    -1,
+      41,    -1,    -1,    -1,    -1,    46,    -1,    -1,    -1,    -1,
+      51,    52,    16,    54,    18,    -1,    -1,    21,    22,    23,
+      -1,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    -1,    -1,    -1,    -1,    41,    -1,    -1,
+      -1,    16,    46,    18,    -1,    -1,    -1,    51,    -1,    -1,
+      54,    -1,    27,    28,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    -1,    -1,    41,    -1,    -1,    -1,
+      16,    46,    18,    -1,    -1,    50,    -1,    -1,    -1,    54,
+      -1,    27,    28,    -1,    30,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    -1,    -1,    41,    -1,    -1,    -1,    -1,
+      46,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     3,     4,     5,     6,     7,     8,    19,    32,    58,
       59,    60,    61,    62,    63,    64,    66,    72,    75,    32,
@@ -804,85 +996,85 @@ static const yytype_uint8 yystos[] =
       17,    67,    51,    54,    77,    62,    63,    73,    74,    32,
       20,    68,    65,    73,    16,    18,    21,    22,    23,    25,
       26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    41,    46,    54,    61,    76,    78,    79,    80,    81,
-      82,    83,    84,    32,    55,    53,    32,    69,    51,    52,
-      63,    72,    55,    54,    54,    54,    32,    50,    83,    50,
-      54,    54,    54,    54,    54,    54,    83,    83,    83,    52,
-      78,    37,    50,     9,    10,    11,    12,    14,    15,    38,
-      39,    40,    41,    42,    43,    44,    47,    48,    62,    53,
-      70,    32,    50,    83,    82,    83,    50,    32,    83,    83,
-      86,    55,    55,    85,    86,    55,    83,    83,    83,    83,
+      36,    41,    46,    52,    54,    61,    76,    78,    79,    80,
+      81,    82,    83,    84,    32,    55,    53,    32,    69,    51,
+      52,    63,    72,    55,    54,    54,    54,    32,    50,    83,
+      50,    54,    54,    54,    54,    54,    54,    83,    83,    83,
+      52,    79,    37,    50,     9,    10,    11,    12,    14,    15,
+      38,    39,    40,    41,    42,    43,    44,    47,    48,    62,
+      53,    70,    32,    50,    83,    82,    83,    50,    32,    83,
+      83,    86,    55,    55,    85,    86,    55,    83,    83,    83,
       83,    83,    83,    83,    83,    83,    83,    83,    83,    83,
-      32,    83,    32,    52,    61,    71,    75,    55,    50,    55,
-      55,    53,    53,    55,    55,    54,    56,    79,    83,    79,
-      63,    83,    50,    85,    50,    24,    87,    55,    55,    82,
-      79,    55,    79
+      83,    32,    83,    32,    52,    61,    71,    75,    55,    50,
+      55,    55,    53,    53,    55,    55,    54,    56,    79,    83,
+      79,    63,    83,    50,    85,    50,    24,    87,    55,    55,
+      82,    79,    55,    79
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
 {
        0,    57,    58,    59,    59,    60,    60,    60,    60,    61,
       62,    63,    63,    63,    63,    63,    63,    64,    65,    65,
       66,    67,    67,    68,    68,    69,    69,    70,    70,    71,
-      71,    72,    72,    73,    73,    74,    74,    75,    76,    77,
-      77,    78,    78,    79,    79,    79,    79,    79,    79,    79,
-      79,    79,    80,    80,    80,    81,    81,    82,    82,    83,
+      71,    72,    72,    73,    73,    74,    74,    75,    76,    76,
+      77,    77,    78,    78,    79,    79,    79,    79,    79,    79,
+      79,    79,    79,    80,    80,    80,    81,    81,    82,    82,
       83,    83,    83,    83,    83,    83,    83,    83,    83,    83,
       83,    83,    83,    83,    83,    83,    83,    83,    83,    83,
-      83,    83,    83,    83,    84,    84,    84,    84,    84,    85,
-      85,    86,    86,    87,    87
+      83,    83,    83,    83,    83,    84,    84,    84,    84,    84,
+      85,    85,    86,    86,    87,    87
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     2,     1,     1,     1,     1,     1,     2,
        2,     1,     1,     1,     1,     1,     2,     5,     3,     0,
        7,     2,     0,     2,     0,     3,     1,     2,     0,     1,
-       1,     5,     5,     1,     0,     3,     1,     2,     4,     2,
-       0,     2,     0,     2,     1,     6,     5,     9,     3,     2,
-       5,     2,     1,     3,     4,     4,     6,     1,     0,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     2,     2,     3,
-       3,     4,     6,     1,     1,     1,     1,     1,     1,     1,
-       0,     3,     1,     2,     0
+       1,     5,     5,     1,     0,     3,     1,     2,     4,     3,
+       2,     0,     2,     1,     2,     1,     6,     5,     9,     3,
+       2,     5,     2,     1,     3,     4,     4,     6,     1,     0,
+       1,     1,     1,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     2,     2,
+       3,     3,     4,     6,     1,     1,     1,     1,     1,     1,
+       1,     0,     3,     1,     2,     0
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -926,20 +1118,27 @@ do {                                            \
 } while (0)
 
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
+/* YYLOCATION_PRINT -- Print the location on the stream.
    This macro was not mandated originally: define only if we know
    we won't break user code: when these are the locations we know.  */
 
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
 
 /* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
 
 YY_ATTRIBUTE_UNUSED
-static unsigned
+static int
 yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  unsigned res = 0;
+  int res = 0;
   int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
   if (0 <= yylocp->first_line)
     {
@@ -959,63 +1158,71 @@ yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
         res += YYFPRINTF (yyo, "-%d", end_col);
     }
   return res;
- }
+}
 
-#  define YY_LOCATION_PRINT(File, Loc)          \
-  yy_location_print_ (File, &(Loc))
+#   define YYLOCATION_PRINT  yy_location_print_
 
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value, Location); \
+                  Kind, Value, Location); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
-  YYUSE (yylocationp);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1024,7 +1231,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, YYL
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1047,21 +1254,22 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                       , &(yylsp[(yyi + 1) - (yynrhs)])                       );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1076,8 +1284,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1100,250 +1308,31 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
 
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1358,6 +1347,8 @@ YYLTYPE yylloc
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1365,53 +1356,45 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-       'yyls': related to locations.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
-    /* The location stack.  */
+    /* The location stack: array, bottom, top.  */
     YYLTYPE yylsa[YYINITDEPTH];
-    YYLTYPE *yyls;
-    YYLTYPE *yylsp;
-
-    /* The locations where the error started and ended.  */
-    YYLTYPE yyerror_range[3];
-
-    YYSIZE_T yystacksize;
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
 
@@ -1419,43 +1402,49 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yylsp = yyls = yylsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
         YYLTYPE *yyls1 = yyls;
 
         /* Each stack pointer address is followed by the size of the
@@ -1463,32 +1452,29 @@ yyparse (void)
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
-                    &yyls1, yysize * sizeof (*yylsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
                     &yystacksize);
-
-        yyls = yyls1;
         yyss = yyss1;
         yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
         YYSTACK_RELOCATE (yyls_alloc, yyls);
@@ -1497,31 +1483,32 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1532,18 +1519,30 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1571,15 +1570,14 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1594,7 +1592,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1610,543 +1608,552 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 98 "parser.y" /* yacc.c:1646  */
-    { 
+  case 2: /* Program: DeclList  */
+#line 98 "parser.y"
+                                   { 
                                       (yylsp[0]); 
                                       Program *program = new Program((yyvsp[0].declList));
                                       // if no errors, advance to next phase
                                       if (ReportError::NumErrors() == 0) { 
                                           program->Check();
+					  program->Resolve();
 					  program->Emit();
 				      }
                                     }
-#line 1630 "y.tab.c" /* yacc.c:1646  */
+#line 1630 "y.tab.c"
     break;
 
-  case 3:
-#line 110 "parser.y" /* yacc.c:1646  */
-    { ((yyval.declList)=(yyvsp[-1].declList))->Append((yyvsp[0].decl)); }
-#line 1636 "y.tab.c" /* yacc.c:1646  */
+  case 3: /* DeclList: DeclList Decl  */
+#line 111 "parser.y"
+                                    { ((yyval.declList)=(yyvsp[-1].declList))->Append((yyvsp[0].decl)); }
+#line 1636 "y.tab.c"
     break;
 
-  case 4:
-#line 111 "parser.y" /* yacc.c:1646  */
-    { ((yyval.declList) = new List<Decl*>)->Append((yyvsp[0].decl)); }
-#line 1642 "y.tab.c" /* yacc.c:1646  */
+  case 4: /* DeclList: Decl  */
+#line 112 "parser.y"
+                                    { ((yyval.declList) = new List<Decl*>)->Append((yyvsp[0].decl)); }
+#line 1642 "y.tab.c"
     break;
 
-  case 6:
-#line 115 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl)=(yyvsp[0].fDecl); }
-#line 1648 "y.tab.c" /* yacc.c:1646  */
+  case 6: /* Decl: FnDecl  */
+#line 116 "parser.y"
+                                    { (yyval.decl)=(yyvsp[0].fDecl); }
+#line 1648 "y.tab.c"
     break;
 
-  case 7:
-#line 116 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl)=(yyvsp[0].var); }
-#line 1654 "y.tab.c" /* yacc.c:1646  */
+  case 7: /* Decl: VarDecl  */
+#line 117 "parser.y"
+                                    { (yyval.decl)=(yyvsp[0].var); }
+#line 1654 "y.tab.c"
     break;
 
-  case 10:
-#line 123 "parser.y" /* yacc.c:1646  */
-    { (yyval.var) = new VarDecl(new Identifier((yylsp[0]), (yyvsp[0].identifier)), (yyvsp[-1].type)); }
-#line 1660 "y.tab.c" /* yacc.c:1646  */
+  case 10: /* Variable: Type T_Identifier  */
+#line 124 "parser.y"
+                                    { (yyval.var) = new VarDecl(new Identifier((yylsp[0]), (yyvsp[0].identifier)), (yyvsp[-1].type)); }
+#line 1660 "y.tab.c"
     break;
 
-  case 11:
-#line 126 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = Type::intType; }
-#line 1666 "y.tab.c" /* yacc.c:1646  */
+  case 11: /* Type: T_Int  */
+#line 127 "parser.y"
+                                    { (yyval.type) = Type::intType; }
+#line 1666 "y.tab.c"
     break;
 
-  case 12:
-#line 127 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = Type::boolType; }
-#line 1672 "y.tab.c" /* yacc.c:1646  */
+  case 12: /* Type: T_Bool  */
+#line 128 "parser.y"
+                                    { (yyval.type) = Type::boolType; }
+#line 1672 "y.tab.c"
     break;
 
-  case 13:
-#line 128 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = Type::stringType; }
-#line 1678 "y.tab.c" /* yacc.c:1646  */
+  case 13: /* Type: T_String  */
+#line 129 "parser.y"
+                                    { (yyval.type) = Type::stringType; }
+#line 1678 "y.tab.c"
     break;
 
-  case 14:
-#line 129 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = Type::doubleType; }
-#line 1684 "y.tab.c" /* yacc.c:1646  */
+  case 14: /* Type: T_Double  */
+#line 130 "parser.y"
+                                    { (yyval.type) = Type::doubleType; }
+#line 1684 "y.tab.c"
     break;
 
-  case 15:
-#line 130 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = new NamedType(new Identifier((yylsp[0]),(yyvsp[0].identifier))); }
-#line 1690 "y.tab.c" /* yacc.c:1646  */
+  case 15: /* Type: T_Identifier  */
+#line 131 "parser.y"
+                                    { (yyval.type) = new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
+#line 1690 "y.tab.c"
     break;
 
-  case 16:
-#line 131 "parser.y" /* yacc.c:1646  */
-    { (yyval.type) = new ArrayType(Join((yylsp[-1]), (yylsp[0])), (yyvsp[-1].type)); }
-#line 1696 "y.tab.c" /* yacc.c:1646  */
+  case 16: /* Type: Type T_Dims  */
+#line 132 "parser.y"
+                                    { (yyval.type) = new ArrayType(Join((yylsp[-1]), (yylsp[0])), (yyvsp[-1].type)); }
+#line 1696 "y.tab.c"
     break;
 
-  case 17:
-#line 135 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl) = new InterfaceDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), (yyvsp[-1].declList)); }
-#line 1702 "y.tab.c" /* yacc.c:1646  */
+  case 17: /* IntfDecl: T_Interface T_Identifier '{' IntfList '}'  */
+#line 136 "parser.y"
+                                    { (yyval.decl) = new InterfaceDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), (yyvsp[-1].declList)); }
+#line 1702 "y.tab.c"
     break;
 
-  case 18:
-#line 139 "parser.y" /* yacc.c:1646  */
-    { ((yyval.declList)=(yyvsp[-2].declList))->Append((yyvsp[-1].fDecl)); }
-#line 1708 "y.tab.c" /* yacc.c:1646  */
+  case 18: /* IntfList: IntfList FnHeader ';'  */
+#line 140 "parser.y"
+                                    { ((yyval.declList)=(yyvsp[-2].declList))->Append((yyvsp[-1].fDecl)); }
+#line 1708 "y.tab.c"
     break;
 
-  case 19:
-#line 140 "parser.y" /* yacc.c:1646  */
-    { (yyval.declList) = new List<Decl*>(); }
-#line 1714 "y.tab.c" /* yacc.c:1646  */
+  case 19: /* IntfList: %empty  */
+#line 141 "parser.y"
+                                    { (yyval.declList) = new List<Decl*>(); }
+#line 1714 "y.tab.c"
     break;
 
-  case 20:
-#line 144 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl) = new ClassDecl(new Identifier((yylsp[-5]), (yyvsp[-5].identifier)), (yyvsp[-4].cType), (yyvsp[-3].cTypeList), (yyvsp[-1].declList)); }
-#line 1720 "y.tab.c" /* yacc.c:1646  */
+  case 20: /* ClassDecl: T_Class T_Identifier OptExt OptImpl '{' FieldList '}'  */
+#line 145 "parser.y"
+                                    { (yyval.decl) = new ClassDecl(new Identifier((yylsp[-5]), (yyvsp[-5].identifier)), (yyvsp[-4].cType), (yyvsp[-3].cTypeList), (yyvsp[-1].declList)); }
+#line 1720 "y.tab.c"
     break;
 
-  case 21:
-#line 148 "parser.y" /* yacc.c:1646  */
-    { (yyval.cType) = new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
-#line 1726 "y.tab.c" /* yacc.c:1646  */
+  case 21: /* OptExt: T_Extends T_Identifier  */
+#line 149 "parser.y"
+                                    { (yyval.cType) = new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
+#line 1726 "y.tab.c"
     break;
 
-  case 22:
-#line 149 "parser.y" /* yacc.c:1646  */
-    { (yyval.cType) = NULL; }
-#line 1732 "y.tab.c" /* yacc.c:1646  */
+  case 22: /* OptExt: %empty  */
+#line 150 "parser.y"
+                                    { (yyval.cType) = NULL; }
+#line 1732 "y.tab.c"
     break;
 
-  case 23:
-#line 153 "parser.y" /* yacc.c:1646  */
-    { (yyval.cTypeList) = (yyvsp[0].cTypeList); }
-#line 1738 "y.tab.c" /* yacc.c:1646  */
+  case 23: /* OptImpl: T_Implements ImpList  */
+#line 154 "parser.y"
+                                    { (yyval.cTypeList) = (yyvsp[0].cTypeList); }
+#line 1738 "y.tab.c"
     break;
 
-  case 24:
-#line 154 "parser.y" /* yacc.c:1646  */
-    { (yyval.cTypeList) = new List<NamedType*>; }
-#line 1744 "y.tab.c" /* yacc.c:1646  */
+  case 24: /* OptImpl: %empty  */
+#line 155 "parser.y"
+                                    { (yyval.cTypeList) = new List<NamedType*>; }
+#line 1744 "y.tab.c"
     break;
 
-  case 25:
-#line 158 "parser.y" /* yacc.c:1646  */
-    { ((yyval.cTypeList)=(yyvsp[-2].cTypeList))->Append(new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier)))); }
-#line 1750 "y.tab.c" /* yacc.c:1646  */
+  case 25: /* ImpList: ImpList ',' T_Identifier  */
+#line 159 "parser.y"
+                                    { ((yyval.cTypeList)=(yyvsp[-2].cTypeList))->Append(new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier)))); }
+#line 1750 "y.tab.c"
     break;
 
-  case 26:
-#line 159 "parser.y" /* yacc.c:1646  */
-    { ((yyval.cTypeList)=new List<NamedType*>)->Append(new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier)))); }
-#line 1756 "y.tab.c" /* yacc.c:1646  */
+  case 26: /* ImpList: T_Identifier  */
+#line 160 "parser.y"
+                                    { ((yyval.cTypeList)=new List<NamedType*>)->Append(new NamedType(new Identifier((yylsp[0]), (yyvsp[0].identifier)))); }
+#line 1756 "y.tab.c"
     break;
 
-  case 27:
-#line 162 "parser.y" /* yacc.c:1646  */
-    { ((yyval.declList)=(yyvsp[-1].declList))->Append((yyvsp[0].decl)); }
-#line 1762 "y.tab.c" /* yacc.c:1646  */
+  case 27: /* FieldList: FieldList Field  */
+#line 163 "parser.y"
+                                    { ((yyval.declList)=(yyvsp[-1].declList))->Append((yyvsp[0].decl)); }
+#line 1762 "y.tab.c"
     break;
 
-  case 28:
-#line 163 "parser.y" /* yacc.c:1646  */
-    { (yyval.declList) = new List<Decl*>(); }
-#line 1768 "y.tab.c" /* yacc.c:1646  */
+  case 28: /* FieldList: %empty  */
+#line 164 "parser.y"
+                                    { (yyval.declList) = new List<Decl*>(); }
+#line 1768 "y.tab.c"
     break;
 
-  case 29:
-#line 166 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl) = (yyvsp[0].var); }
-#line 1774 "y.tab.c" /* yacc.c:1646  */
+  case 29: /* Field: VarDecl  */
+#line 167 "parser.y"
+                                    { (yyval.decl) = (yyvsp[0].var); }
+#line 1774 "y.tab.c"
     break;
 
-  case 30:
-#line 167 "parser.y" /* yacc.c:1646  */
-    { (yyval.decl) = (yyvsp[0].fDecl); }
-#line 1780 "y.tab.c" /* yacc.c:1646  */
+  case 30: /* Field: FnDecl  */
+#line 168 "parser.y"
+                                    { (yyval.decl) = (yyvsp[0].fDecl); }
+#line 1780 "y.tab.c"
     break;
 
-  case 31:
-#line 172 "parser.y" /* yacc.c:1646  */
-    { (yyval.fDecl) = new FnDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), (yyvsp[-4].type), (yyvsp[-1].varList)); }
-#line 1786 "y.tab.c" /* yacc.c:1646  */
+  case 31: /* FnHeader: Type T_Identifier '(' Formals ')'  */
+#line 173 "parser.y"
+                                    { (yyval.fDecl) = new FnDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), (yyvsp[-4].type), (yyvsp[-1].varList)); }
+#line 1786 "y.tab.c"
     break;
 
-  case 32:
-#line 174 "parser.y" /* yacc.c:1646  */
-    { (yyval.fDecl) = new FnDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), Type::voidType, (yyvsp[-1].varList)); }
-#line 1792 "y.tab.c" /* yacc.c:1646  */
+  case 32: /* FnHeader: T_Void T_Identifier '(' Formals ')'  */
+#line 175 "parser.y"
+                                    { (yyval.fDecl) = new FnDecl(new Identifier((yylsp[-3]), (yyvsp[-3].identifier)), Type::voidType, (yyvsp[-1].varList)); }
+#line 1792 "y.tab.c"
     break;
 
-  case 33:
-#line 177 "parser.y" /* yacc.c:1646  */
-    { (yyval.varList) = (yyvsp[0].varList); }
-#line 1798 "y.tab.c" /* yacc.c:1646  */
+  case 33: /* Formals: FormalList  */
+#line 178 "parser.y"
+                                    { (yyval.varList) = (yyvsp[0].varList); }
+#line 1798 "y.tab.c"
     break;
 
-  case 34:
-#line 178 "parser.y" /* yacc.c:1646  */
-    { (yyval.varList) = new List<VarDecl*>; }
-#line 1804 "y.tab.c" /* yacc.c:1646  */
+  case 34: /* Formals: %empty  */
+#line 179 "parser.y"
+                                    { (yyval.varList) = new List<VarDecl*>; }
+#line 1804 "y.tab.c"
     break;
 
-  case 35:
-#line 182 "parser.y" /* yacc.c:1646  */
-    { ((yyval.varList)=(yyvsp[-2].varList))->Append((yyvsp[0].var)); }
-#line 1810 "y.tab.c" /* yacc.c:1646  */
+  case 35: /* FormalList: FormalList ',' Variable  */
+#line 183 "parser.y"
+                                    { ((yyval.varList)=(yyvsp[-2].varList))->Append((yyvsp[0].var)); }
+#line 1810 "y.tab.c"
     break;
 
-  case 36:
-#line 183 "parser.y" /* yacc.c:1646  */
-    { ((yyval.varList) = new List<VarDecl*>)->Append((yyvsp[0].var)); }
-#line 1816 "y.tab.c" /* yacc.c:1646  */
+  case 36: /* FormalList: Variable  */
+#line 184 "parser.y"
+                                    { ((yyval.varList) = new List<VarDecl*>)->Append((yyvsp[0].var)); }
+#line 1816 "y.tab.c"
     break;
 
-  case 37:
-#line 186 "parser.y" /* yacc.c:1646  */
-    { ((yyval.fDecl)=(yyvsp[-1].fDecl))->SetFunctionBody((yyvsp[0].stmt)); }
-#line 1822 "y.tab.c" /* yacc.c:1646  */
+  case 37: /* FnDecl: FnHeader StmtBlock  */
+#line 187 "parser.y"
+                                    { ((yyval.fDecl)=(yyvsp[-1].fDecl))->SetFunctionBody((yyvsp[0].stmt)); }
+#line 1822 "y.tab.c"
     break;
 
-  case 38:
-#line 190 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new StmtBlock((yyvsp[-2].varList), (yyvsp[-1].stmtList)); }
-#line 1828 "y.tab.c" /* yacc.c:1646  */
+  case 38: /* StmtBlock: '{' VarDecls StmtList '}'  */
+#line 191 "parser.y"
+                                    { (yyval.stmt) = new StmtBlock((yyvsp[-2].varList), (yyvsp[-1].stmtList)); }
+#line 1828 "y.tab.c"
     break;
 
-  case 39:
-#line 193 "parser.y" /* yacc.c:1646  */
-    { ((yyval.varList)=(yyvsp[-1].varList))->Append((yyvsp[0].var)); }
-#line 1834 "y.tab.c" /* yacc.c:1646  */
+  case 39: /* StmtBlock: '{' VarDecls '}'  */
+#line 192 "parser.y"
+                                    { (yyval.stmt) = new StmtBlock((yyvsp[-1].varList), new List<Stmt*>); }
+#line 1834 "y.tab.c"
     break;
 
-  case 40:
-#line 194 "parser.y" /* yacc.c:1646  */
-    { (yyval.varList) = new List<VarDecl*>; }
-#line 1840 "y.tab.c" /* yacc.c:1646  */
+  case 40: /* VarDecls: VarDecls VarDecl  */
+#line 195 "parser.y"
+                                    { ((yyval.varList)=(yyvsp[-1].varList))->Append((yyvsp[0].var)); }
+#line 1840 "y.tab.c"
     break;
 
-  case 41:
-#line 197 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmtList) = (yyvsp[0].stmtList); (yyval.stmtList)->InsertAt((yyvsp[-1].stmt), 0); }
-#line 1846 "y.tab.c" /* yacc.c:1646  */
+  case 41: /* VarDecls: %empty  */
+#line 196 "parser.y"
+                                    { (yyval.varList) = new List<VarDecl*>; }
+#line 1846 "y.tab.c"
     break;
 
-  case 42:
-#line 198 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmtList) = new List<Stmt*>; }
-#line 1852 "y.tab.c" /* yacc.c:1646  */
+  case 42: /* StmtList: StmtList Stmt  */
+#line 203 "parser.y"
+                                    { ((yyval.stmtList)=(yyvsp[-1].stmtList))->Append((yyvsp[0].stmt)); }
+#line 1852 "y.tab.c"
     break;
 
-  case 43:
-#line 201 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = (yyvsp[-1].expr); }
-#line 1858 "y.tab.c" /* yacc.c:1646  */
+  case 43: /* StmtList: Stmt  */
+#line 204 "parser.y"
+                                    { ((yyval.stmtList) = new List<Stmt*>)->Append((yyvsp[0].stmt)); }
+#line 1858 "y.tab.c"
     break;
 
-  case 45:
-#line 204 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new IfStmt((yyvsp[-3].expr), (yyvsp[-1].stmt), (yyvsp[0].stmt)); }
-#line 1864 "y.tab.c" /* yacc.c:1646  */
+  case 44: /* Stmt: OptExpr ';'  */
+#line 207 "parser.y"
+                                    { (yyval.stmt) = (yyvsp[-1].expr); }
+#line 1864 "y.tab.c"
     break;
 
-  case 46:
-#line 206 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new WhileStmt((yyvsp[-2].expr), (yyvsp[0].stmt)); }
-#line 1870 "y.tab.c" /* yacc.c:1646  */
+  case 46: /* Stmt: T_If '(' Expr ')' Stmt OptElse  */
+#line 210 "parser.y"
+                                    { (yyval.stmt) = new IfStmt((yyvsp[-3].expr), (yyvsp[-1].stmt), (yyvsp[0].stmt)); }
+#line 1870 "y.tab.c"
     break;
 
-  case 47:
-#line 208 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new ForStmt((yyvsp[-6].expr), (yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].stmt)); }
-#line 1876 "y.tab.c" /* yacc.c:1646  */
+  case 47: /* Stmt: T_While '(' Expr ')' Stmt  */
+#line 212 "parser.y"
+                                    { (yyval.stmt) = new WhileStmt((yyvsp[-2].expr), (yyvsp[0].stmt)); }
+#line 1876 "y.tab.c"
     break;
 
-  case 48:
-#line 210 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new ReturnStmt((yylsp[-1]), (yyvsp[-1].expr)); }
-#line 1882 "y.tab.c" /* yacc.c:1646  */
+  case 48: /* Stmt: T_For '(' OptExpr ';' Expr ';' OptExpr ')' Stmt  */
+#line 214 "parser.y"
+                                    { (yyval.stmt) = new ForStmt((yyvsp[-6].expr), (yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].stmt)); }
+#line 1882 "y.tab.c"
     break;
 
-  case 49:
-#line 212 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new ReturnStmt((yylsp[-1]), new EmptyExpr()); }
-#line 1888 "y.tab.c" /* yacc.c:1646  */
+  case 49: /* Stmt: T_Return Expr ';'  */
+#line 216 "parser.y"
+                                    { (yyval.stmt) = new ReturnStmt((yylsp[-1]), (yyvsp[-1].expr)); }
+#line 1888 "y.tab.c"
     break;
 
-  case 50:
-#line 214 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new PrintStmt((yyvsp[-2].exprList)); }
-#line 1894 "y.tab.c" /* yacc.c:1646  */
+  case 50: /* Stmt: T_Return ';'  */
+#line 218 "parser.y"
+                                    { (yyval.stmt) = new ReturnStmt((yylsp[-1]), new EmptyExpr()); }
+#line 1894 "y.tab.c"
     break;
 
-  case 51:
-#line 215 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = new BreakStmt((yylsp[-1])); }
-#line 1900 "y.tab.c" /* yacc.c:1646  */
+  case 51: /* Stmt: T_Print '(' ExprList ')' ';'  */
+#line 220 "parser.y"
+                                    { (yyval.stmt) = new PrintStmt((yyvsp[-2].exprList)); }
+#line 1900 "y.tab.c"
     break;
 
-  case 52:
-#line 218 "parser.y" /* yacc.c:1646  */
-    { (yyval.lvalue) = new FieldAccess(NULL, new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
-#line 1906 "y.tab.c" /* yacc.c:1646  */
+  case 52: /* Stmt: T_Break ';'  */
+#line 221 "parser.y"
+                                    { (yyval.stmt) = new BreakStmt((yylsp[-1])); }
+#line 1906 "y.tab.c"
     break;
 
-  case 53:
-#line 219 "parser.y" /* yacc.c:1646  */
-    { (yyval.lvalue) = new FieldAccess((yyvsp[-2].expr), new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
-#line 1912 "y.tab.c" /* yacc.c:1646  */
+  case 53: /* LValue: T_Identifier  */
+#line 224 "parser.y"
+                                     { (yyval.lvalue) = new FieldAccess(NULL, new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
+#line 1912 "y.tab.c"
     break;
 
-  case 54:
-#line 220 "parser.y" /* yacc.c:1646  */
-    { (yyval.lvalue) = new ArrayAccess(Join((yylsp[-3]), (yylsp[0])), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 1918 "y.tab.c" /* yacc.c:1646  */
+  case 54: /* LValue: Expr '.' T_Identifier  */
+#line 225 "parser.y"
+                                     { (yyval.lvalue) = new FieldAccess((yyvsp[-2].expr), new Identifier((yylsp[0]), (yyvsp[0].identifier))); }
+#line 1918 "y.tab.c"
     break;
 
-  case 55:
-#line 224 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new Call(Join((yylsp[-3]),(yylsp[0])), NULL, new Identifier((yylsp[-3]),(yyvsp[-3].identifier)), (yyvsp[-1].exprList)); }
-#line 1924 "y.tab.c" /* yacc.c:1646  */
+  case 55: /* LValue: Expr '[' Expr ']'  */
+#line 226 "parser.y"
+                                     { (yyval.lvalue) = new ArrayAccess(Join((yylsp[-3]), (yylsp[0])), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 1924 "y.tab.c"
     break;
 
-  case 56:
-#line 226 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new Call(Join((yylsp[-5]),(yylsp[0])), (yyvsp[-5].expr), new Identifier((yylsp[-3]),(yyvsp[-3].identifier)), (yyvsp[-1].exprList)); }
-#line 1930 "y.tab.c" /* yacc.c:1646  */
+  case 56: /* Call: T_Identifier '(' Actuals ')'  */
+#line 230 "parser.y"
+                                    { (yyval.expr) = new Call(Join((yylsp[-3]),(yylsp[0])), NULL, new Identifier((yylsp[-3]),(yyvsp[-3].identifier)), (yyvsp[-1].exprList)); }
+#line 1930 "y.tab.c"
     break;
 
-  case 57:
-#line 229 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[0].expr); }
-#line 1936 "y.tab.c" /* yacc.c:1646  */
+  case 57: /* Call: Expr '.' T_Identifier '(' Actuals ')'  */
+#line 232 "parser.y"
+                                    { (yyval.expr) = new Call(Join((yylsp[-5]),(yylsp[0])), (yyvsp[-5].expr), new Identifier((yylsp[-3]),(yyvsp[-3].identifier)), (yyvsp[-1].exprList)); }
+#line 1936 "y.tab.c"
     break;
 
-  case 58:
-#line 230 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new EmptyExpr(); }
-#line 1942 "y.tab.c" /* yacc.c:1646  */
+  case 58: /* OptExpr: Expr  */
+#line 235 "parser.y"
+                                    { (yyval.expr) = (yyvsp[0].expr); }
+#line 1942 "y.tab.c"
     break;
 
-  case 59:
-#line 233 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[0].lvalue); }
-#line 1948 "y.tab.c" /* yacc.c:1646  */
+  case 59: /* OptExpr: %empty  */
+#line 236 "parser.y"
+                                    { (yyval.expr) = new EmptyExpr(); }
+#line 1948 "y.tab.c"
     break;
 
-  case 62:
-#line 236 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new AssignExpr((yyvsp[-2].lvalue), new Operator((yylsp[-1]),"="), (yyvsp[0].expr)); }
-#line 1954 "y.tab.c" /* yacc.c:1646  */
+  case 60: /* Expr: LValue  */
+#line 239 "parser.y"
+                                    { (yyval.expr) = (yyvsp[0].lvalue); }
+#line 1954 "y.tab.c"
     break;
 
-  case 63:
-#line 237 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]), "+"), (yyvsp[0].expr)); }
-#line 1960 "y.tab.c" /* yacc.c:1646  */
+  case 63: /* Expr: LValue '=' Expr  */
+#line 242 "parser.y"
+                                    { (yyval.expr) = new AssignExpr((yyvsp[-2].lvalue), new Operator((yylsp[-1]),"="), (yyvsp[0].expr)); }
+#line 1960 "y.tab.c"
     break;
 
-  case 64:
-#line 238 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]), "-"), (yyvsp[0].expr)); }
-#line 1966 "y.tab.c" /* yacc.c:1646  */
+  case 64: /* Expr: Expr '+' Expr  */
+#line 243 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]), "+"), (yyvsp[0].expr)); }
+#line 1966 "y.tab.c"
     break;
 
-  case 65:
-#line 239 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"/"), (yyvsp[0].expr)); }
-#line 1972 "y.tab.c" /* yacc.c:1646  */
+  case 65: /* Expr: Expr '-' Expr  */
+#line 244 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]), "-"), (yyvsp[0].expr)); }
+#line 1972 "y.tab.c"
     break;
 
-  case 66:
-#line 240 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"*"), (yyvsp[0].expr)); }
-#line 1978 "y.tab.c" /* yacc.c:1646  */
+  case 66: /* Expr: Expr '/' Expr  */
+#line 245 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"/"), (yyvsp[0].expr)); }
+#line 1978 "y.tab.c"
     break;
 
-  case 67:
-#line 241 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"%"), (yyvsp[0].expr)); }
-#line 1984 "y.tab.c" /* yacc.c:1646  */
+  case 67: /* Expr: Expr '*' Expr  */
+#line 246 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"*"), (yyvsp[0].expr)); }
+#line 1984 "y.tab.c"
     break;
 
-  case 68:
-#line 242 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new EqualityExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"=="), (yyvsp[0].expr)); }
-#line 1990 "y.tab.c" /* yacc.c:1646  */
+  case 68: /* Expr: Expr '%' Expr  */
+#line 247 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"%"), (yyvsp[0].expr)); }
+#line 1990 "y.tab.c"
     break;
 
-  case 69:
-#line 243 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new EqualityExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"!="), (yyvsp[0].expr)); }
-#line 1996 "y.tab.c" /* yacc.c:1646  */
+  case 69: /* Expr: Expr T_Equal Expr  */
+#line 248 "parser.y"
+                                    { (yyval.expr) = new EqualityExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"=="), (yyvsp[0].expr)); }
+#line 1996 "y.tab.c"
     break;
 
-  case 70:
-#line 244 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"<"), (yyvsp[0].expr)); }
-#line 2002 "y.tab.c" /* yacc.c:1646  */
+  case 70: /* Expr: Expr T_NotEqual Expr  */
+#line 249 "parser.y"
+                                    { (yyval.expr) = new EqualityExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"!="), (yyvsp[0].expr)); }
+#line 2002 "y.tab.c"
     break;
 
-  case 71:
-#line 245 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),">"), (yyvsp[0].expr)); }
-#line 2008 "y.tab.c" /* yacc.c:1646  */
+  case 71: /* Expr: Expr '<' Expr  */
+#line 250 "parser.y"
+                                    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"<"), (yyvsp[0].expr)); }
+#line 2008 "y.tab.c"
     break;
 
-  case 72:
-#line 247 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"<="), (yyvsp[0].expr)); }
-#line 2014 "y.tab.c" /* yacc.c:1646  */
+  case 72: /* Expr: Expr '>' Expr  */
+#line 251 "parser.y"
+                                    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),">"), (yyvsp[0].expr)); }
+#line 2014 "y.tab.c"
     break;
 
-  case 73:
-#line 249 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),">="), (yyvsp[0].expr)); }
-#line 2020 "y.tab.c" /* yacc.c:1646  */
+  case 73: /* Expr: Expr T_LessEqual Expr  */
+#line 253 "parser.y"
+                                    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"<="), (yyvsp[0].expr)); }
+#line 2020 "y.tab.c"
     break;
 
-  case 74:
-#line 250 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new LogicalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"&&"), (yyvsp[0].expr)); }
-#line 2026 "y.tab.c" /* yacc.c:1646  */
+  case 74: /* Expr: Expr T_GreaterEqual Expr  */
+#line 255 "parser.y"
+                                    { (yyval.expr) = new RelationalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),">="), (yyvsp[0].expr)); }
+#line 2026 "y.tab.c"
     break;
 
-  case 75:
-#line 251 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new LogicalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"||"), (yyvsp[0].expr)); }
-#line 2032 "y.tab.c" /* yacc.c:1646  */
+  case 75: /* Expr: Expr T_And Expr  */
+#line 256 "parser.y"
+                                    { (yyval.expr) = new LogicalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"&&"), (yyvsp[0].expr)); }
+#line 2032 "y.tab.c"
     break;
 
-  case 76:
-#line 252 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = (yyvsp[-1].expr); }
-#line 2038 "y.tab.c" /* yacc.c:1646  */
+  case 76: /* Expr: Expr T_Or Expr  */
+#line 257 "parser.y"
+                                    { (yyval.expr) = new LogicalExpr((yyvsp[-2].expr), new Operator((yylsp[-1]),"||"), (yyvsp[0].expr)); }
+#line 2038 "y.tab.c"
     break;
 
-  case 77:
-#line 254 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ArithmeticExpr(new Operator((yylsp[-1]),"-"), (yyvsp[0].expr)); }
-#line 2044 "y.tab.c" /* yacc.c:1646  */
+  case 77: /* Expr: '(' Expr ')'  */
+#line 258 "parser.y"
+                                    { (yyval.expr) = (yyvsp[-1].expr); }
+#line 2044 "y.tab.c"
     break;
 
-  case 78:
-#line 255 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new LogicalExpr(new Operator((yylsp[-1]),"!"), (yyvsp[0].expr)); }
-#line 2050 "y.tab.c" /* yacc.c:1646  */
+  case 78: /* Expr: '-' Expr  */
+#line 260 "parser.y"
+                                    { (yyval.expr) = new ArithmeticExpr(new Operator((yylsp[-1]),"-"), (yyvsp[0].expr)); }
+#line 2050 "y.tab.c"
     break;
 
-  case 79:
-#line 257 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ReadIntegerExpr(Join((yylsp[-2]),(yylsp[0]))); }
-#line 2056 "y.tab.c" /* yacc.c:1646  */
+  case 79: /* Expr: '!' Expr  */
+#line 261 "parser.y"
+                                    { (yyval.expr) = new LogicalExpr(new Operator((yylsp[-1]),"!"), (yyvsp[0].expr)); }
+#line 2056 "y.tab.c"
     break;
 
-  case 80:
-#line 258 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new ReadLineExpr(Join((yylsp[-2]),(yylsp[0]))); }
-#line 2062 "y.tab.c" /* yacc.c:1646  */
+  case 80: /* Expr: T_ReadInteger '(' ')'  */
+#line 263 "parser.y"
+                                    { (yyval.expr) = new ReadIntegerExpr(Join((yylsp[-2]),(yylsp[0]))); }
+#line 2062 "y.tab.c"
     break;
 
-  case 81:
-#line 260 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new NewExpr(Join((yylsp[-3]),(yylsp[0])),new NamedType(new Identifier((yylsp[-1]),(yyvsp[-1].identifier)))); }
-#line 2068 "y.tab.c" /* yacc.c:1646  */
+  case 81: /* Expr: T_ReadLine '(' ')'  */
+#line 264 "parser.y"
+                                    { (yyval.expr) = new ReadLineExpr(Join((yylsp[-2]),(yylsp[0]))); }
+#line 2068 "y.tab.c"
     break;
 
-  case 82:
-#line 262 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new NewArrayExpr(Join((yylsp[-5]),(yylsp[0])),(yyvsp[-3].expr), (yyvsp[-1].type)); }
-#line 2074 "y.tab.c" /* yacc.c:1646  */
+  case 82: /* Expr: T_New '(' T_Identifier ')'  */
+#line 266 "parser.y"
+                                    { (yyval.expr) = new NewExpr(Join((yylsp[-3]),(yylsp[0])),new NamedType(new Identifier((yylsp[-1]), (yyvsp[-1].identifier)))); }
+#line 2074 "y.tab.c"
     break;
 
-  case 83:
-#line 263 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new This((yylsp[0])); }
-#line 2080 "y.tab.c" /* yacc.c:1646  */
+  case 83: /* Expr: T_NewArray '(' Expr ',' Type ')'  */
+#line 268 "parser.y"
+                                    { (yyval.expr) = new NewArrayExpr(Join((yylsp[-5]),(yylsp[0])),(yyvsp[-3].expr), (yyvsp[-1].type)); }
+#line 2080 "y.tab.c"
     break;
 
-  case 84:
-#line 266 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new IntConstant((yylsp[0]),(yyvsp[0].integerConstant)); }
-#line 2086 "y.tab.c" /* yacc.c:1646  */
+  case 84: /* Expr: T_This  */
+#line 269 "parser.y"
+                                    { (yyval.expr) = new This((yylsp[0])); }
+#line 2086 "y.tab.c"
     break;
 
-  case 85:
-#line 267 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new BoolConstant((yylsp[0]),(yyvsp[0].boolConstant)); }
-#line 2092 "y.tab.c" /* yacc.c:1646  */
+  case 85: /* Constant: T_IntConstant  */
+#line 272 "parser.y"
+                                    { (yyval.expr) = new IntConstant((yylsp[0]),(yyvsp[0].integerConstant)); }
+#line 2092 "y.tab.c"
     break;
 
-  case 86:
-#line 268 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new DoubleConstant((yylsp[0]),(yyvsp[0].doubleConstant)); }
-#line 2098 "y.tab.c" /* yacc.c:1646  */
+  case 86: /* Constant: T_BoolConstant  */
+#line 273 "parser.y"
+                                    { (yyval.expr) = new BoolConstant((yylsp[0]),(yyvsp[0].boolConstant)); }
+#line 2098 "y.tab.c"
     break;
 
-  case 87:
-#line 269 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new StringConstant((yylsp[0]),(yyvsp[0].stringConstant)); }
-#line 2104 "y.tab.c" /* yacc.c:1646  */
+  case 87: /* Constant: T_DoubleConstant  */
+#line 274 "parser.y"
+                                    { (yyval.expr) = new DoubleConstant((yylsp[0]),(yyvsp[0].doubleConstant)); }
+#line 2104 "y.tab.c"
     break;
 
-  case 88:
-#line 270 "parser.y" /* yacc.c:1646  */
-    { (yyval.expr) = new NullConstant((yylsp[0])); }
-#line 2110 "y.tab.c" /* yacc.c:1646  */
+  case 88: /* Constant: T_StringConstant  */
+#line 275 "parser.y"
+                                    { (yyval.expr) = new StringConstant((yylsp[0]),(yyvsp[0].stringConstant)); }
+#line 2110 "y.tab.c"
     break;
 
-  case 89:
-#line 273 "parser.y" /* yacc.c:1646  */
-    { (yyval.exprList) = (yyvsp[0].exprList); }
-#line 2116 "y.tab.c" /* yacc.c:1646  */
+  case 89: /* Constant: T_Null  */
+#line 276 "parser.y"
+                                    { (yyval.expr) = new NullConstant((yylsp[0])); }
+#line 2116 "y.tab.c"
     break;
 
-  case 90:
-#line 274 "parser.y" /* yacc.c:1646  */
-    { (yyval.exprList) = new List<Expr*>; }
-#line 2122 "y.tab.c" /* yacc.c:1646  */
+  case 90: /* Actuals: ExprList  */
+#line 279 "parser.y"
+                                    { (yyval.exprList) = (yyvsp[0].exprList); }
+#line 2122 "y.tab.c"
     break;
 
-  case 91:
-#line 277 "parser.y" /* yacc.c:1646  */
-    { ((yyval.exprList)=(yyvsp[-2].exprList))->Append((yyvsp[0].expr)); }
-#line 2128 "y.tab.c" /* yacc.c:1646  */
+  case 91: /* Actuals: %empty  */
+#line 280 "parser.y"
+                                    { (yyval.exprList) = new List<Expr*>; }
+#line 2128 "y.tab.c"
     break;
 
-  case 92:
-#line 278 "parser.y" /* yacc.c:1646  */
-    { ((yyval.exprList) = new List<Expr*>)->Append((yyvsp[0].expr)); }
-#line 2134 "y.tab.c" /* yacc.c:1646  */
+  case 92: /* ExprList: ExprList ',' Expr  */
+#line 283 "parser.y"
+                                    { ((yyval.exprList)=(yyvsp[-2].exprList))->Append((yyvsp[0].expr)); }
+#line 2134 "y.tab.c"
     break;
 
-  case 93:
-#line 281 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = (yyvsp[0].stmt); }
-#line 2140 "y.tab.c" /* yacc.c:1646  */
+  case 93: /* ExprList: Expr  */
+#line 284 "parser.y"
+                                    { ((yyval.exprList) = new List<Expr*>)->Append((yyvsp[0].expr)); }
+#line 2140 "y.tab.c"
     break;
 
-  case 94:
-#line 283 "parser.y" /* yacc.c:1646  */
-    { (yyval.stmt) = NULL; }
-#line 2146 "y.tab.c" /* yacc.c:1646  */
+  case 94: /* OptElse: T_Else Stmt  */
+#line 287 "parser.y"
+                                    { (yyval.stmt) = (yyvsp[0].stmt); }
+#line 2146 "y.tab.c"
     break;
 
+  case 95: /* OptElse: %empty  */
+#line 289 "parser.y"
+                                    { (yyval.stmt) = NULL; }
+#line 2152 "y.tab.c"
+    break;
+
+
+#line 2156 "y.tab.c"
 
-#line 2150 "y.tab.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2160,11 +2167,10 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
@@ -2172,14 +2178,13 @@ yyreduce:
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -2190,50 +2195,15 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
   yyerror_range[1] = yylloc;
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2262,14 +2232,12 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[1] = yylsp[1-yylen];
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
@@ -2285,13 +2253,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2305,7 +2274,7 @@ yyerrlab1:
 
       yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2316,13 +2285,11 @@ yyerrlab1:
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
   yyerror_range[2] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the lookahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, yyerror_range, 2);
-  *++yylsp = yyloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2333,26 +2300,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2368,20 +2339,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 287 "parser.y" /* yacc.c:1906  */
+
+#line 293 "parser.y"
 
 
 